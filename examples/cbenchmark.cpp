@@ -32,27 +32,27 @@
 // call "C:\Program Files\Microsoft Visual Studio\2022\Community\VC\Auxiliary\Build\vcvars64.bat"
 // cl /nologo /MD /std:c++latest /Bt+ /I ..\include  ..\examples\cbenchmark.cpp|find "c1xx.dll"
 //----------------------------------------------------------------------------------------
-#define FIX8_CONJURE_ENUM_ALL_OPTIMIZATIONS
+// Define CBENCHMARK_PROBE to measure enumerator probing (no range set, not continuous).
+// cmake builds this both ways as cbenchmark_probe and cbenchmark_batch, the latter
+// with FIX8_CONJURE_ENUM_BATCH_PROBE defined. cbenchmark_cached also defines CBENCHMARK_CACHE
+// and uses the reflection cache generated by conjure_enum_generate, so nothing is probed.
+//----------------------------------------------------------------------------------------
+#if defined CBENCHMARK_PROBE
+# define FIX8_CONJURE_ENUM_MINIMAL
+# define FIX8_CONJURE_ENUM_NO_ANON
+#else
+# define FIX8_CONJURE_ENUM_ALL_OPTIMIZATIONS
+#endif
 #include <fix8/conjure_enum.hpp>
 
 //-----------------------------------------------------------------------------------------
-enum class numbers
-{
-	zero, one, two, three, four,
-	five, six, seven, eight, nine,
-	ten, eleven, twelve, thirteen, fourteen,
-	fifteen, sixteen, seventeen, eighteen, nineteen,
-	twenty, twenty_one, twenty_two, twenty_three, twenty_four,
-	twenty_five, twenty_six, twenty_seven, twenty_eight, twenty_nine,
-	thirty, thirty_one, thirty_two, thirty_three, thirty_four,
-	thirty_five, thirty_six, thirty_seven, thirty_eight, thirty_nine,
-	forty, forty_one, forty_two, forty_three, forty_four,
-	forty_five, forty_six, forty_seven, forty_eight, forty_nine,
-	fifty, fifty_one, fifty_two, fifty_three, fifty_four,
-	fifty_five, fifty_six, fifty_seven, fifty_eight, fifty_nine,
-	sixty, sixty_one, sixty_two, sixty_three
-};
+#include "cbenchmark.hpp"
+#if not defined CBENCHMARK_PROBE
 FIX8_CONJURE_ENUM_SET_RANGE(numbers::zero, numbers::sixty_three);
+#endif
+#if defined CBENCHMARK_CACHE
+# include "cbenchmark_cache.hpp"
+#endif
 
 auto test_conjure_enum(numbers num)
 {
@@ -6,5 +6,8 @@
 #	ClangBuildAnalyzerLoc is the directory where ClangBuildAnalyzer can be found
 # and
 #	ArtifactLoc is the directory where conjure_enum is built
+# Optionally:
+#	Target is the benchmark target to analyze (default cbenchmark; also cbenchmark_probe, cbenchmark_batch)
 
-$ClangBuildAnalyzerLoc/ClangBuildAnalyzer --all $ArtifactLoc/CMakeFiles/cbenchmark.dir cbenchmark.dat; $ClangBuildAnalyzerLoc/ClangBuildAnalyzer --analyze cbenchmark.dat
+Target=${Target:-cbenchmark}
+$ClangBuildAnalyzerLoc/ClangBuildAnalyzer --all $ArtifactLoc/CMakeFiles/$Target.dir $Target.dat; $ClangBuildAnalyzerLoc/ClangBuildAnalyzer --analyze $Target.dat
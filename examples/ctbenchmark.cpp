@@ -0,0 +1,237 @@
+//----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------------------
+// Compile-time scaling benchmark (POSIX only)
+// Generates a translation unit for each combination of enum size, sparsity (stride between
+// values), scoped/unscoped, anonymous/named namespace, range width and API used, compiles
+// it and records the wall time and peak RSS of the compiler as CSV. cmake builds this as
+// ctbenchmark using the configured compiler; run with -h for options.
+//----------------------------------------------------------------------------------------
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#if not defined CTBENCHMARK_CXX
+# define CTBENCHMARK_CXX "c++"
+#endif
+#if not defined CTBENCHMARK_INCLUDE
+# define CTBENCHMARK_INCLUDE "include"
+#endif
+
+//-----------------------------------------------------------------------------------------
+struct config
+{
+	int size, stride;
+	bool scoped, anon, wide;
+	std::string_view api;
+};
+
+struct result
+{
+	bool ok;
+	long wall_ms, peak_rss_kb;
+};
+
+//-----------------------------------------------------------------------------------------
+std::vector<std::string> split(std::string_view what, char sep)
+{
+	std::vector<std::string> result;
+	for (std::size_t pos{}; pos <= what.size();)
+	{
+		const auto fnd{std::min(what.find(sep, pos), what.size())};
+		if (fnd > pos)
+			result.emplace_back(what.substr(pos, fnd - pos));
+		pos = fnd + 1;
+	}
+	return result;
+}
+
+//-----------------------------------------------------------------------------------------
+// size 0 is the baseline: the header alone with no enum reflected
+//-----------------------------------------------------------------------------------------
+std::string generate(const config& cfg)
+{
+	std::ostringstream os;
+	os << "#include <fix8/conjure_enum.hpp>\n";
+	if (cfg.size == 0)
+	{
+		os << "int main(void) { return 0; }\n";
+		return os.str();
+	}
+	os << (cfg.anon ? "namespace\n{\n" : "namespace bench\n{\n") << '\t' << (cfg.scoped ? "enum class" : "enum") << " E : int\n\t{\n\t\t";
+	for (int ii{}; ii < cfg.size; ++ii)
+		os << 'v' << ii << " = " << ii * cfg.stride << (ii % 8 == 7 ? ",\n\t\t" : ", ");
+	const int last{(cfg.size - 1) * cfg.stride};
+	const std::string_view ename{cfg.anon ? "E" : "bench::E"};
+	os << "\n\t};\n}\n" << "FIX8_CONJURE_ENUM_SET_RANGE_INTS(" << ename << ", 0, " << (cfg.wide ? last * 2 + 1 : last) << ")\n"
+		<< "using ec = FIX8::conjure_enum<" << ename << ">;\n"
+		<< "int main(int argc, char **)\n{\n";
+	if (cfg.api == "string")
+		os << "\treturn static_cast<int>(ec::enum_to_string(static_cast<" << ename << ">(argc)).size());\n";
+	else
+		os << "\tconst auto idx{static_cast<std::size_t>(argc) % ec::count()};\n"
+			"\treturn static_cast<int>(ec::names[idx].size() + std::get<0>(ec::scoped_entries[idx]).size());\n";
+	os << "}\n";
+	return os.str();
+}
+
+//-----------------------------------------------------------------------------------------
+result compile(const std::vector<std::string>& args, const std::filesystem::path& errfile)
+{
+	std::vector<char *> argv;
+	for (const auto& pp : args)
+		argv.push_back(const_cast<char *>(pp.c_str()));
+	argv.push_back(nullptr);
+
+	const auto start{std::chrono::steady_clock::now()};
+	const pid_t pid{fork()};
+	if (pid == 0)
+	{
+		if (const int fd{open(errfile.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644)}; fd >= 0)
+		{
+			dup2(fd, STDOUT_FILENO);
+			dup2(fd, STDERR_FILENO);
+			close(fd);
+		}
+		execvp(argv[0], argv.data());
+		_exit(127);
+	}
+	if (pid < 0)
+		return {};
+	int status{};
+	rusage ru{};
+	if (wait4(pid, &status, 0, &ru) != pid) // child usage includes its waited for children (cc1plus etc)
+		return {};
+	const auto wall{std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()};
+#if defined __APPLE__
+	const long rss{ru.ru_maxrss / 1024}; // bytes
+#else
+	const long rss{ru.ru_maxrss}; // kilobytes
+#endif
+	return { WIFEXITED(status) && WEXITSTATUS(status) == 0, static_cast<long>(wall), rss };
+}
+
+//-----------------------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+	std::string compiler{CTBENCHMARK_CXX}, incdir{CTBENCHMARK_INCLUDE}, flags{"-std=c++20"}, sizes{"8,64,256,1000,4000"}, strides{"1,4"}, outfile;
+	int runs{1};
+	bool keep{};
+	for (int opt; (opt = getopt(argc, argv, "c:I:f:s:p:r:o:kh")) != -1;)
+	{
+		switch (opt)
+		{
+		case 'c': compiler = optarg; break;
+		case 'I': incdir = optarg; break;
+		case 'f': flags = optarg; break;
+		case 's': sizes = optarg; break;
+		case 'p': strides = optarg; break;
+		case 'r': runs = std::max(1, std::stoi(optarg)); break;
+		case 'o': outfile = optarg; break;
+		case 'k': keep = true; break;
+		default:
+			std::cout << R"(
+This program measures how compile time and compiler memory scale with enum size and shape.
+For each size and stride it generates an enum (scoped and unscoped, in a named and anonymous
+namespace, with a tight range and one twice as wide) and compiles it twice, once calling only
+enum_to_string ("string") and once using names and scoped_entries ("names"). A baseline row
+(size 0) compiles the header alone. Output is CSV, one row per compilation.
+
+Usage: )" << argv[0] << " [-c compiler] [-I incdir] [-f flags] [-s sizes] [-p strides] [-r runs] [-o csv] [-kh]" << R"(
+  -c compiler (default )" CTBENCHMARK_CXX R"()
+  -I conjure_enum include directory (default )" CTBENCHMARK_INCLUDE R"()
+  -f compiler flags (default "-std=c++20")
+  -s comma separated enum sizes (default 8,64,256,1000,4000)
+  -p comma separated strides between enum values, 1 is continuous (default 1,4)
+  -r compile each this many times, reporting the best wall time (default 1)
+  -o write CSV to this file (default stdout)
+  -k keep the generated sources and compiler output
+  -h help
+)";
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	std::ofstream ofs;
+	if (!outfile.empty())
+		ofs.open(outfile);
+	std::ostream& os{outfile.empty() ? std::cout : ofs};
+	const auto work{std::filesystem::temp_directory_path() / ("ctbenchmark." + std::to_string(getpid()))};
+	std::filesystem::create_directories(work);
+
+	std::vector<config> configs{{ 0, 1, false, false, false, "none" }};
+	for (const auto& sz : split(sizes, ','))
+		for (const auto& st : split(strides, ','))
+			for (const bool scoped : { true, false })
+				for (const bool anon : { false, true })
+					for (const bool wide : { false, true })
+						for (const std::string_view api : { "string", "names" })
+							configs.push_back({ std::stoi(sz), std::stoi(st), scoped, anon, wide, api });
+
+	os << "compiler,size,stride,scoped,anon,range,api,status,wall_ms,peak_rss_kb" << std::endl;
+	int failed{};
+	for (int cnt{}; const auto& cfg : configs)
+	{
+		const auto name{"ct" + std::to_string(cnt++)};
+		const auto src{work / (name + ".cpp")};
+		std::ofstream{src} << generate(cfg);
+		auto args{split(flags, ' ')};
+		args.insert(args.begin(), compiler);
+		args.insert(args.end(), { "-I" + incdir, "-c", src.string(), "-o", (work / (name + ".o")).string() });
+		result best{};
+		for (int ii{}; ii < runs; ++ii)
+		{
+			const auto res{compile(args, work / (name + ".out"))};
+			if (ii == 0 || res.wall_ms < best.wall_ms)
+				best = res;
+			if (!res.ok)
+				break;
+		}
+		failed += !best.ok;
+		os << std::filesystem::path(compiler).filename().string() << ',' << cfg.size << ',' << cfg.stride << ','
+			<< cfg.scoped << ',' << cfg.anon << ',' << (cfg.wide ? "wide" : "tight") << ',' << cfg.api << ','
+			<< (best.ok ? "ok" : "fail") << ',' << best.wall_ms << ',' << best.peak_rss_kb << std::endl;
+	}
+	if (keep)
+		std::cerr << "sources and compiler output kept in " << work << '\n';
+	else
+		std::filesystem::remove_all(work);
+	return failed ? 2 : 0;
+}
@@ -0,0 +1,370 @@
+//----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------------------
+// Runtime lookup benchmark
+// Compares string_to_enum and unscoped_string_to_enum with a binary search (std::equal_range)
+// over sorted_entries and unscoped_entries, for enums of 10, 60, 100 and 1000 enumerators, and of
+// 100 enumerators in a nested namespace. Enums of up to 64 names compare against a padded name
+// slot, larger ones against a packed key. Each pass looks up every name in a shuffled order plus
+// one miss per name. The tokenizing columns decode "name=1" with unscoped_match_prefix, against
+// finding the '=' and slicing for unscoped_string_to_enum. A second table times enum_to_string and
+// contains for sparse enums of 40 values, one in 0..195 (a direct table indexed by value) and one
+// in 0..39351 (a perfect hash of the values), against a binary search over values, and
+// enum_to_string(value, true) against remove_scope applied to the scoped name. A third table
+// resolves a mix of scoped and unscoped names with any_string_to_enum, against has_scope,
+// add_scope and string_to_enum as used by enum_bitset before. A fourth table resolves upper case
+// names with nocase_string_to_enum, against copying the name to lower case and calling
+// string_to_enum. A fifth table looks up NUL terminated names with string_to_enum(const char *),
+// against strlen and string_to_enum(std::string_view). A sixth table times dispatch over a table
+// of every other value, against the std::equal_range search it used before. A seventh table looks
+// up names of enums with more than 64 names through their packed keys, against comparing the name
+// in the hash slot as before.
+// The lbenchmark_O0 target builds this file without optimization, for comparison with debug
+// builds. Run with an optional number of passes (default 2000).
+//----------------------------------------------------------------------------------------
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cctype>
+#include <fix8/conjure_enum.hpp>
+
+//-----------------------------------------------------------------------------------------
+#define BENCH_D10(p) p##3, p##7, p##1, p##9, p##5, p##0, p##8, p##2, p##6, p##4
+#define BENCH_D100(p) BENCH_D10(p##3), BENCH_D10(p##7), BENCH_D10(p##1), BENCH_D10(p##9), BENCH_D10(p##5), \
+	BENCH_D10(p##0), BENCH_D10(p##8), BENCH_D10(p##2), BENCH_D10(p##6), BENCH_D10(p##4)
+#define BENCH_D1000(p) BENCH_D100(p##3), BENCH_D100(p##7), BENCH_D100(p##1), BENCH_D100(p##9), BENCH_D100(p##5), \
+	BENCH_D100(p##0), BENCH_D100(p##8), BENCH_D100(p##2), BENCH_D100(p##6), BENCH_D100(p##4)
+#define BENCH_W40 \
+	w0=0, w1009=1009, w2018=2018, w3027=3027, w4036=4036, w5045=5045, w6054=6054, w7063=7063, \
+	w8072=8072, w9081=9081, w10090=10090, w11099=11099, w12108=12108, w13117=13117, w14126=14126, w15135=15135, \
+	w16144=16144, w17153=17153, w18162=18162, w19171=19171, w20180=20180, w21189=21189, w22198=22198, w23207=23207, \
+	w24216=24216, w25225=25225, w26234=26234, w27243=27243, w28252=28252, w29261=29261, w30270=30270, w31279=31279, \
+	w32288=32288, w33297=33297, w34306=34306, w35315=35315, w36324=36324, w37333=37333, w38342=38342, w39351=39351
+#define BENCH_W40_VALUES(e) \
+	e::w0, e::w1009, e::w2018, e::w3027, e::w4036, e::w5045, e::w6054, e::w7063, \
+	e::w8072, e::w9081, e::w10090, e::w11099, e::w12108, e::w13117, e::w14126, e::w15135, \
+	e::w16144, e::w17153, e::w18162, e::w19171, e::w20180, e::w21189, e::w22198, e::w23207, \
+	e::w24216, e::w25225, e::w26234, e::w27243, e::w28252, e::w29261, e::w30270, e::w31279, \
+	e::w32288, e::w33297, e::w34306, e::w35315, e::w36324, e::w37333, e::w38342, e::w39351
+
+enum class field10 : int { BENCH_D10(tag_) };
+enum class field60 : int { BENCH_D10(tag_a), BENCH_D10(tag_b), BENCH_D10(tag_c), BENCH_D10(tag_d), BENCH_D10(tag_e), BENCH_D10(tag_f) };
+enum class field100 : int { BENCH_D100(tag_) };
+enum class field1000 : int { BENCH_D1000(tag_) };
+namespace market::fix44::session { enum class field100 : int { BENCH_D100(tag_) }; }
+enum class sparse40 : int
+{
+	v0=0, v5=5, v10=10, v15=15, v20=20, v25=25, v30=30, v35=35, v40=40, v45=45,
+	v50=50, v55=55, v60=60, v65=65, v70=70, v75=75, v80=80, v85=85, v90=90, v95=95,
+	v100=100, v105=105, v110=110, v115=115, v120=120, v125=125, v130=130, v135=135, v140=140, v145=145,
+	v150=150, v155=155, v160=160, v165=165, v170=170, v175=175, v180=180, v185=185, v190=190, v195=195
+};
+enum class wide40 : int { BENCH_W40 };
+FIX8_CONJURE_ENUM_SET_RANGE_INTS(field10, 0, 9)
+FIX8_CONJURE_ENUM_SET_RANGE_INTS(field60, 0, 59)
+FIX8_CONJURE_ENUM_SET_RANGE_INTS(field100, 0, 99)
+FIX8_CONJURE_ENUM_SET_LARGE_RANGE_INTS(field1000, 0, 999)
+FIX8_CONJURE_ENUM_SET_RANGE_INTS(market::fix44::session::field100, 0, 99)
+FIX8_CONJURE_ENUM_SET_RANGE_INTS(sparse40, 0, 199)
+FIX8_CONJURE_ENUM_SET_VALUES(wide40, BENCH_W40_VALUES(wide40))
+
+using namespace FIX8;
+
+//-----------------------------------------------------------------------------------------
+template<typename T>
+struct binary_search
+{
+	using ec = conjure_enum<T>;
+	static constexpr bool comp(const typename ec::enum_tuple& pl, const typename ec::enum_tuple& pr) noexcept
+	{
+		return std::get<std::string_view>(pl) < std::get<std::string_view>(pr);
+	}
+	static std::optional<T> scoped(std::string_view str) noexcept
+	{
+		const auto [begin,end] { std::equal_range(ec::sorted_entries.cbegin(), ec::sorted_entries.cend(), typename ec::enum_tuple(T{}, str), comp) };
+		return begin != end ? std::get<T>(*begin) : std::optional<T>{};
+	}
+	static std::optional<T> unscoped(std::string_view str) noexcept
+	{
+		const auto [begin,end] { std::equal_range(ec::unscoped_entries.cbegin(), ec::unscoped_entries.cend(), typename ec::enum_tuple(T{}, str), comp) };
+		return begin != end ? std::get<T>(*begin) : std::optional<T>{};
+	}
+	static std::string_view name(T value) noexcept
+	{
+		const auto result { std::lower_bound(ec::values.cbegin(), ec::values.cend(), value) };
+		return result != ec::values.cend() && *result == value ? std::get<std::string_view>(ec::entries[result - ec::values.cbegin()]) : std::string_view{};
+	}
+	static bool contains(T value) noexcept
+	{
+		return std::binary_search(ec::values.cbegin(), ec::values.cend(), value);
+	}
+};
+
+//-----------------------------------------------------------------------------------------
+template<typename V, typename Fn>
+double measure(const std::vector<V>& items, int passes, Fn func)
+{
+	std::size_t found{};
+	const auto start { std::chrono::steady_clock::now() };
+	for (int ii{}; ii < passes; ++ii)
+		for (const auto& item : items)
+			found += static_cast<bool>(func(item));
+	const std::chrono::duration<double, std::nano> elapsed { std::chrono::steady_clock::now() - start };
+	if (found != items.size() / 2 * passes)
+		std::cerr << "lookup error\n";
+	return elapsed.count() / (static_cast<double>(items.size()) * passes);
+}
+
+template<typename T>
+std::vector<std::string> make_names(bool scoped, std::string_view suffix={})
+{
+	std::vector<std::string> result;
+	for (const auto& [value, name] : conjure_enum<T>::entries)
+	{
+		result.emplace_back(scoped ? name : conjure_enum<T>::remove_scope(name));
+		result.emplace_back(result.back());
+		result.back().back() = 'x'; // a miss of the same length
+		result.back() += suffix;
+		result[result.size() - 2] += suffix;
+	}
+	std::shuffle(result.begin(), result.end(), std::mt19937{42});
+	return result;
+}
+
+template<typename T>
+std::optional<T> prefix_token(std::string_view str) noexcept
+{
+	if (const auto result { conjure_enum<T>::unscoped_match_prefix(str) }; result)
+		if (const auto [value, consumed] { *result }; consumed < str.size() && str[consumed] == '=')
+			return value;
+	return {};
+}
+
+template<typename T>
+std::optional<T> slice_token(std::string_view str) noexcept
+{
+	if (const auto pos { str.find('=') }; pos != std::string_view::npos)
+		return conjure_enum<T>::unscoped_string_to_enum(str.substr(0, pos));
+	return {};
+}
+
+template<typename T>
+void run(int passes)
+{
+	const auto scoped { make_names<T>(true) }, unscoped { make_names<T>(false) }, tokens { make_names<T>(false, "=1") };
+	const auto hash_scoped { measure(scoped, passes, [](std::string_view str) { return conjure_enum<T>::string_to_enum(str); }) };
+	const auto bin_scoped { measure(scoped, passes, [](std::string_view str) { return binary_search<T>::scoped(str); }) };
+	const auto hash_unscoped { measure(unscoped, passes, [](std::string_view str) { return conjure_enum<T>::unscoped_string_to_enum(str); }) };
+	const auto bin_unscoped { measure(unscoped, passes, [](std::string_view str) { return binary_search<T>::unscoped(str); }) };
+	const auto prefix { measure(tokens, passes, prefix_token<T>) };
+	const auto slice { measure(tokens, passes, slice_token<T>) };
+	std::cout << std::setw(6) << conjure_enum<T>::count() << std::fixed << std::setprecision(1)
+		<< std::setw(12) << hash_scoped << std::setw(12) << bin_scoped
+		<< std::setw(12) << hash_unscoped << std::setw(12) << bin_unscoped
+		<< std::setw(12) << prefix << std::setw(12) << slice << '\n';
+}
+
+template<typename T>
+void run_values(int passes)
+{
+	using U = std::underlying_type_t<T>;
+	std::vector<T> values;
+	for (const auto value : conjure_enum<T>::values)
+	{
+		values.push_back(value);
+		values.push_back(static_cast<T>(static_cast<U>(value) + 1)); // a miss within the range
+	}
+	std::shuffle(values.begin(), values.end(), std::mt19937{42});
+	const auto direct_name { measure(values, passes, [](T value) { return !conjure_enum<T>::enum_to_string(value).empty(); }) };
+	const auto bin_name { measure(values, passes, [](T value) { return !binary_search<T>::name(value).empty(); }) };
+	const auto direct_contains { measure(values, passes, [](T value) { return conjure_enum<T>::contains(value); }) };
+	const auto bin_contains { measure(values, passes, [](T value) { return binary_search<T>::contains(value); }) };
+	const auto noscope { measure(values, passes, [](T value) { return !conjure_enum<T>::enum_to_string(value, true).empty(); }) };
+	const auto remove_scope { measure(values, passes, [](T value) { return !conjure_enum<T>::remove_scope(conjure_enum<T>::enum_to_string(value)).empty(); }) };
+	std::cout << std::setw(6) << conjure_enum<T>::count() << std::setw(8) << conjure_enum<T>::enum_to_underlying(conjure_enum<T>::max_v) << std::fixed << std::setprecision(1)
+		<< std::setw(12) << direct_name << std::setw(12) << bin_name
+		<< std::setw(12) << direct_contains << std::setw(12) << bin_contains
+		<< std::setw(12) << noscope << std::setw(14) << remove_scope << '\n';
+}
+
+template<typename T>
+std::optional<T> three_step(std::string_view str) noexcept
+{
+	if (!conjure_enum<T>::has_scope(str))
+		str = conjure_enum<T>::add_scope(str);
+	return conjure_enum<T>::string_to_enum(str);
+}
+
+template<typename T>
+void run_any(int passes)
+{
+	auto names { make_names<T>(true) };
+	const auto unscoped { make_names<T>(false) };
+	names.insert(names.end(), unscoped.cbegin(), unscoped.cend());
+	std::shuffle(names.begin(), names.end(), std::mt19937{42});
+	const auto any { measure(names, passes, [](std::string_view str) { return conjure_enum<T>::any_string_to_enum(str); }) };
+	const auto three { measure(names, passes, three_step<T>) };
+	std::cout << std::setw(6) << conjure_enum<T>::count() << std::fixed << std::setprecision(1)
+		<< std::setw(12) << any << std::setw(12) << three << '\n';
+}
+
+template<typename T>
+std::optional<T> lower_copy(std::string_view str)
+{
+	std::string lower { str };
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char chr) { return std::tolower(chr); });
+	return conjure_enum<T>::string_to_enum(lower);
+}
+
+template<typename T>
+void run_nocase(int passes)
+{
+	auto names { make_names<T>(true) };
+	for (auto& name : names)
+		std::transform(name.begin(), name.end(), name.begin(), [](unsigned char chr) { return std::toupper(chr); });
+	const auto nocase { measure(names, passes, [](std::string_view str) { return conjure_enum<T>::nocase_string_to_enum(str); }) };
+	const auto lower { measure(names, passes, lower_copy<T>) };
+	std::cout << std::setw(6) << conjure_enum<T>::count() << std::fixed << std::setprecision(1)
+		<< std::setw(12) << nocase << std::setw(12) << lower << '\n';
+}
+
+template<typename T>
+void run_cstr(int passes)
+{
+	const auto scoped { make_names<T>(true) }, unscoped { make_names<T>(false) };
+	const auto cstr { measure(scoped, passes, [](const std::string& str) { return conjure_enum<T>::string_to_enum(str.c_str()); }) };
+	const auto strlen { measure(scoped, passes, [](const std::string& str) { return conjure_enum<T>::string_to_enum(std::string_view(str.c_str())); }) };
+	const auto u_cstr { measure(unscoped, passes, [](const std::string& str) { return conjure_enum<T>::unscoped_string_to_enum(str.c_str()); }) };
+	const auto u_strlen { measure(unscoped, passes, [](const std::string& str) { return conjure_enum<T>::unscoped_string_to_enum(std::string_view(str.c_str())); }) };
+	std::cout << std::setw(6) << conjure_enum<T>::count() << std::fixed << std::setprecision(1)
+		<< std::setw(12) << cstr << std::setw(12) << strlen << std::setw(12) << u_cstr << std::setw(12) << u_strlen << '\n';
+}
+
+/// dispatch as it was, through std::equal_range with a probe tuple and the tuple_comp comparator
+template<typename T, std::size_t I, typename Fn>
+int equal_range_dispatch(T ev, int nval, const std::array<std::tuple<T, Fn>, I>& disp)
+{
+	const auto [begin,end] { std::equal_range(disp.cbegin(), disp.cend(), std::make_tuple(ev, Fn()), conjure_enum<T>::template tuple_comp<Fn>) };
+	return begin != end ? std::invoke(std::get<Fn>(*begin), ev) : nval;
+}
+
+template<typename T>
+void run_dispatch(int passes)
+{
+	using fn = int(*)(T);
+	std::array<std::tuple<T, fn>, conjure_enum<T>::count() / 2> disp{};
+	for (std::size_t idx{}; idx < disp.size(); ++idx)
+		disp[idx] = { conjure_enum<T>::values[idx * 2], [](T value) { return static_cast<int>(value); } };
+	std::vector<T> values { conjure_enum<T>::values.cbegin(), conjure_enum<T>::values.cend() };
+	std::shuffle(values.begin(), values.end(), std::mt19937{42});
+	const auto dispatch { measure(values, passes, [&disp](T value) { return conjure_enum<T>::dispatch(value, -1, disp) != -1; }) };
+	const auto range { measure(values, passes, [&disp](T value) { return equal_range_dispatch(value, -1, disp) != -1; }) };
+	std::cout << std::setw(6) << disp.size() << std::fixed << std::setprecision(1)
+		<< std::setw(12) << dispatch << std::setw(12) << range << '\n';
+}
+
+/// string_to_enum as it was before packed keys: the hash slot gives an index and the name itself is compared
+template<typename T>
+struct name_compare : conjure_enum_core<T>
+{
+	using _core = conjure_enum_core<T>;
+	static std::optional<T> scoped(std::string_view str) noexcept
+	{
+		constexpr const auto& names { _core::_enum_names };
+		constexpr const auto& table { _core::template _hash_v<_core::_enum_names> };
+		const auto hash { _core::_hash_chars(str.data(), str.size(), table.seed) };
+		const auto idx { table.slot[_core::template _hash_slot<names.size()>(hash, table.disp[_core::template _hash_bucket<names.size()>(hash)])] };
+		return names[idx] == str ? _core::_enum_values[idx] : std::optional<T>{};
+	}
+};
+
+template<typename T>
+void run_keys(int passes)
+{
+	static_assert(conjure_enum<T>::strategy().names == name_lookup::keys);
+	const auto scoped { make_names<T>(true) };
+	const auto keys { measure(scoped, passes, [](std::string_view str) { return conjure_enum<T>::string_to_enum(str); }) };
+	const auto compare { measure(scoped, passes, [](std::string_view str) { return name_compare<T>::scoped(str); }) };
+	std::cout << std::setw(6) << conjure_enum<T>::count() << std::fixed << std::setprecision(1)
+		<< std::setw(12) << keys << std::setw(12) << compare << '\n';
+}
+
+//-----------------------------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+	const int passes { argc > 1 ? std::max(1, std::stoi(argv[1])) : 2000 };
+	std::cout << "ns per lookup, " << passes << " passes, half of all lookups miss\n"
+		<< std::setw(6) << "count" << std::setw(12) << "hash" << std::setw(12) << "binary"
+		<< std::setw(12) << "u-hash" << std::setw(12) << "u-binary" << std::setw(12) << "prefix" << std::setw(12) << "slice" << '\n';
+	run<field10>(passes * 100);
+	run<field60>(passes * 16);
+	run<field100>(passes * 10);
+	run<field1000>(passes);
+	std::cout << "\nthe same, 100 names in a nested namespace (market::fix44::session::field100::tag_37)\n";
+	run<market::fix44::session::field100>(passes * 10);
+	std::cout << "\nns per value lookup, sparse enum\n"
+		<< std::setw(6) << "count" << std::setw(8) << "max" << std::setw(12) << "string" << std::setw(12) << "binary"
+		<< std::setw(12) << "contains" << std::setw(12) << "binary"
+		<< std::setw(12) << "noscope" << std::setw(14) << "remove_scope" << '\n';
+	run_values<sparse40>(passes * 50);
+	run_values<wide40>(passes * 50);
+	std::cout << "\nns per lookup, scoped and unscoped names mixed\n"
+		<< std::setw(6) << "count" << std::setw(12) << "any" << std::setw(12) << "3-step" << '\n';
+	run_any<field10>(passes * 50);
+	run_any<field100>(passes * 5);
+	run_any<field1000>(passes / 2 + 1);
+	std::cout << "\nns per lookup, upper case names\n"
+		<< std::setw(6) << "count" << std::setw(12) << "nocase" << std::setw(12) << "lower+exact" << '\n';
+	run_nocase<field10>(passes * 50);
+	run_nocase<field100>(passes * 5);
+	run_nocase<field1000>(passes / 2 + 1);
+	std::cout << "\nns per lookup, NUL terminated names\n"
+		<< std::setw(6) << "count" << std::setw(12) << "const char*" << std::setw(12) << "strlen"
+		<< std::setw(12) << "u-const" << std::setw(12) << "u-strlen" << '\n';
+	run_cstr<field10>(passes * 50);
+	run_cstr<field100>(passes * 5);
+	run_cstr<field1000>(passes / 2 + 1);
+	run_cstr<market::fix44::session::field100>(passes * 5);
+	std::cout << "\nns per dispatch, half of all values in the table\n"
+		<< std::setw(6) << "count" << std::setw(12) << "dispatch" << std::setw(12) << "equal_range" << '\n';
+	run_dispatch<field10>(passes * 100);
+	run_dispatch<field100>(passes * 10);
+	run_dispatch<field1000>(passes);
+	std::cout << "\nns per lookup, more than 64 names, half of all lookups miss\n"
+		<< std::setw(6) << "count" << std::setw(12) << "key" << std::setw(12) << "compare" << '\n';
+	run_keys<field100>(passes * 10);
+	run_keys<field1000>(passes);
+	run_keys<market::fix44::session::field100>(passes * 10);
+	return 0;
+}
@@ -0,0 +1,39 @@
+#!/bin/bash
+# Compare the compile time of examples/modtest.cpp using import fix8.conjure_enum against textual
+# inclusion of the headers. Run from the repo root.
+# Example:
+#	CXX=clang++-18 examples/mbenchmark.sh
+# Where:
+#	CXX is the compiler to use (default g++; the module is experimental, see the README)
+# Optionally:
+#	Runs is the number of compilations to time, best wall time is reported (default 5)
+
+CXX=${CXX:-g++}
+Runs=${Runs:-5}
+Src=$PWD
+Work=$(mktemp -d)
+trap 'rm -rf $Work' EXIT
+cd $Work
+
+if $CXX --version | grep -q clang; then
+	$CXX -std=c++20 -I$Src/include --precompile -x c++-module $Src/modules/conjure_enum.cppm -o fix8.conjure_enum.pcm || exit 1
+	Import="-fmodule-file=fix8.conjure_enum=fix8.conjure_enum.pcm"
+else
+	$CXX -std=c++20 -fmodules-ts -I$Src/include -c -x c++ $Src/modules/conjure_enum.cppm -o conjure_enum.o || exit 1
+	Import="-fmodules-ts"
+fi
+
+best()
+{
+	local best=
+	for ((ii = 0; ii < Runs; ++ii)); do
+		local st=$(date +%s%N)
+		"$@" || exit 1
+		local el=$(( ($(date +%s%N) - st) / 1000000 ))
+		[[ -z $best || $el -lt $best ]] && best=$el
+	done
+	echo $best
+}
+
+echo "$CXX #include: $(best $CXX -std=c++20 -I$Src/include -DMODTEST_INCLUDE -c $Src/examples/modtest.cpp -o modtest.o)ms"
+echo "$CXX import: $(best $CXX -std=c++20 -I$Src/include $Import -c $Src/examples/modtest.cpp -o modtest.o)ms"
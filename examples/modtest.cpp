@@ -0,0 +1,59 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------------------
+// Uses conjure_enum via import fix8.conjure_enum, or with MODTEST_INCLUDE defined via the
+// headers. cmake builds both (modtest, modtest_include) when BUILD_MODULE is enabled;
+// see examples/mbenchmark.sh to compare compile times.
+//----------------------------------------------------------------------------------------
+#if defined MODTEST_INCLUDE
+# include <fix8/conjure_enum.hpp>
+# include <fix8/conjure_enum_bitset.hpp>
+# include <fix8/conjure_type.hpp>
+#else
+# include <source_location> // gcc evaluates std::source_location::current() in the importing TU
+# include <fix8/conjure_enum_macros.hpp>
+import fix8.conjure_enum;
+#endif
+
+//-----------------------------------------------------------------------------------------
+enum class component : int { scheme, authority, userinfo, user, password, host, port, path, query, fragment };
+FIX8_CONJURE_ENUM_SET_RANGE(component::scheme, component::fragment)
+
+//-----------------------------------------------------------------------------------------
+using namespace FIX8;
+
+//-----------------------------------------------------------------------------------------
+int main(void)
+{
+	static_assert(conjure_enum<component>::string_to_enum("component::path") == component::path);
+	static_assert(conjure_type<component>::as_string_view() == "component");
+	constexpr enum_bitset<component> eb { component::host, component::path };
+	return eb.count() == 2 && conjure_enum<component>::enum_to_string(component::query) == "component::query" ? 0 : 1;
+}
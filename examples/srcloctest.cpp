@@ -73,6 +73,8 @@ class conjure_enum : public conjure_type<T>
 public:
 	template<T e>
 	static consteval const char *epeek() noexcept { return std::source_location::current().function_name(); }
+	template<T... e>
+	static consteval const char *epeek_batch() noexcept { return std::source_location::current().function_name(); }
 };
 
 using UType = std::vector<std::tuple<int, char, std::string_view>>;
@@ -148,7 +150,12 @@ int main(int argc, char **argv)
 			conjure_type<TEST1::NineEnums>::tpeek(),
 			conjure_type<TEST1::NineEnums1>::tpeek(),
 			conjure_type<TEST::TEST1::NineEnums>::tpeek(),
-			conjure_type<TEST::TEST1::NineEnums1>::tpeek()
+			conjure_type<TEST::TEST1::NineEnums1>::tpeek(), "",
+		"10. batched enum values",
+			conjure_enum<Namespace_Enum_Type>::epeek_batch<Namespace_Enum_Type::Value, (Namespace_Enum_Type)100>(),
+			conjure_enum<Namespace_Enum_Type1>::epeek_batch<Namespace_Enum_Type1::Value, (Namespace_Enum_Type1)100>(),
+			conjure_enum<Anon_Enum_Type>::epeek_batch<Anon_Enum_Type::Value, (Anon_Enum_Type)100>(),
+			conjure_enum<Anon_Enum_Type1>::epeek_batch<Anon_Enum_Type1::Value, (Anon_Enum_Type1)100>()
    };
 
 	bool mkd{}, cpl{true}, hlp{};
@@ -159,7 +166,7 @@ int main(int argc, char **argv)
 	if (hlp)
 	{
 		std::cout << R"(
-This program shows the output generated by your compiler. There are nine different
+This program shows the output generated by your compiler. There are ten different
 sets of tests - conjure_enum and conjure_type use this information to inform the
 parsing algorithm to extract enum and type info. For most compilers, there will be
 few if any differences between compiler versions - certainly few that impact
@@ -0,0 +1,71 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------------------
+// conjure_type vs conjure_short_type benchmark
+// Prints the names of 64 deeply nested template types. cmake builds this as tbenchmark using
+// conjure_type and as tbenchmark_short, with TBENCHMARK_SHORT defined, using conjure_short_type.
+// Compare compile time and memory of the two targets and the size of the binaries.
+//----------------------------------------------------------------------------------------
+#include <iostream>
+#include <map>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fix8/conjure_type.hpp>
+
+//-----------------------------------------------------------------------------------------
+namespace bench
+{
+	using UType = std::vector<std::tuple<int, char, std::string_view>>;
+	template<int N>
+	using heavy = std::map<std::integral_constant<int, N>, std::tuple<UType, std::map<std::string_view, UType>, std::vector<std::pair<UType, UType>>>>;
+}
+
+#if defined TBENCHMARK_SHORT
+template<typename T>
+using type_name = FIX8::conjure_short_type<T>;
+#else
+template<typename T>
+using type_name = FIX8::conjure_type<T>;
+#endif
+
+template<std::size_t... I>
+void print(std::index_sequence<I...>)
+{
+	((std::cout << type_name<bench::heavy<I>>::as_string_view() << '\n'), ...);
+}
+
+int main(void)
+{
+	print(std::make_index_sequence<64>());
+	return 0;
+}
@@ -49,7 +49,7 @@
 namespace FIX8 {
 
 //-----------------------------------------------------------------------------------------
-template<typename T>
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
 concept valid_bitset_enum = valid_enum<T> and requires(T)
 {
 	requires conjure_enum<T>::is_continuous();
@@ -61,7 +61,7 @@ concept valid_bitset_enum = valid_enum<T> and requires(T)
 // bitset based on supplied enum
 // Note: your enum sequence must be 0 based, continuous and the last enum value < count of enumerations
 //-----------------------------------------------------------------------------------------
-template<valid_bitset_enum T>
+FIX8_CONJURE_ENUM_EXPORT template<valid_bitset_enum T>
 class enum_bitset
 {
 	static constexpr auto countof { conjure_enum<T>::count() };
@@ -110,6 +110,17 @@ class enum_bitset
 
 	static constexpr int correct_count(int val) noexcept { return val ? val - unused_bits : 0; }
 
+	/// add one separated substring, trimmed of whitespace; throws if it is not a name unless errors are ignored
+	static constexpr void add_token(enum_bitset& result, std::string_view src, bool anyscope, bool ignore_errors)
+	{
+		const auto bg(src.find_first_not_of(" \t"));
+		const auto srcp { bg == std::string_view::npos ? src : src.substr(bg, src.find_last_not_of(" \t") - bg + 1) };
+		if (auto ev { anyscope ? conjure_enum<T>::any_string_to_enum(srcp) : conjure_enum<T>::string_to_enum(srcp) }; ev)
+			result |= *ev;
+		else if (!ignore_errors)
+			throw std::invalid_argument(std::string(srcp).c_str());
+	}
+
 public:
 	using enum_bitset_underlying_type = U;
 	using reference = _reference<enum_bitset>;
@@ -119,6 +130,9 @@ public:
 	explicit constexpr enum_bitset(std::bitset<countof> from) : _present(U(from.to_ullong())) {}
 	constexpr enum_bitset(std::string_view from, bool anyscope=false, char sep='|', bool ignore_errors=true)
 		: _present(factory(from, anyscope, sep, ignore_errors)) {}
+	template<c_string C>
+	constexpr enum_bitset(const C& from, bool anyscope=false, char sep='|', bool ignore_errors=true)
+		: _present(factory(static_cast<const char *>(from), anyscope, sep, ignore_errors)) {}
 
 	template<valid_bitset_enum... E>
 	requires (sizeof...(E) > 1)
@@ -314,38 +328,38 @@ public:
 	static constexpr U factory(std::string_view src, bool anyscope, char sep, bool ignore_errors)
 	{
 		enum_bitset result;
-		constexpr auto trim([](std::string_view src) noexcept ->auto
-		{
-		   const auto bg(src.find_first_not_of(" \t"));
-			return bg == std::string_view::npos ? src : src.substr(bg, src.find_last_not_of(" \t") - bg + 1);
-		});
-		auto process([anyscope,&result](std::string_view src) noexcept ->auto
-		{
-			if (anyscope && !conjure_enum<T>::has_scope(src))
-				src = conjure_enum<T>::add_scope(src);
-			if (auto ev { conjure_enum<T>::string_to_enum(src) }; ev)
-			{
-				result |= *ev;
-				return true;
-			}
-			return false;
-		});
 		for (std::string_view::size_type pos{}, fnd{};; pos = fnd + 1)
 		{
 			if ((fnd = src.find_first_of(sep, pos)) != std::string_view::npos)
 			{
-				if (auto srcp { trim(src.substr(pos, fnd - pos)) }; !process(trim(srcp)) && !ignore_errors)
-					throw std::invalid_argument(std::string(srcp).c_str());
+				add_token(result, src.substr(pos, fnd - pos), anyscope, ignore_errors);
 				continue;
 			}
 			if (pos < src.size())
-				if (auto srcp { trim(src.substr(pos, src.size() - pos)) }; !process(trim(srcp)) && !ignore_errors)
-					throw std::invalid_argument(std::string(srcp).c_str());
+				add_token(result, src.substr(pos, src.size() - pos), anyscope, ignore_errors);
 			break;
 		}
       return result._present;
 	}
 
+	/// create a bitset from a NUL terminated custom separated enum string; each substring is found by scanning
+	/// for the separator, so the string is not measured first
+	static constexpr U factory(const char *src, bool anyscope, char sep, bool ignore_errors)
+	{
+		enum_bitset result;
+		for (; src; ++src)
+		{
+			const char *bg { src };
+			while (*src && *src != sep)
+				++src;
+			if (*src || src != bg)
+				add_token(result, std::string_view(bg, src - bg), anyscope, ignore_errors);
+			if (!*src)
+				break;
+		}
+      return result._present;
+	}
+
 	constexpr std::string to_string(char zero='0', char one='1') const noexcept
 	{
 		return std::bitset<countof>(_present).to_string(zero, one);
@@ -377,13 +391,13 @@ public:
 	}
 };
 
-template<typename T>
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
 constexpr enum_bitset<T> operator&(const enum_bitset<T>& lh, const enum_bitset<T>& rh) noexcept
 	{ return lh.operator&(rh.to_ulong()); }
-template<typename T>
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
 constexpr enum_bitset<T> operator|(const enum_bitset<T>& lh, const enum_bitset<T>& rh) noexcept
 	{ return lh.operator|(rh.to_ulong()); }
-template<typename T>
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
 constexpr enum_bitset<T> operator^(const enum_bitset<T>& lh, const enum_bitset<T>& rh) noexcept
 	{ return lh.operator^(rh.to_ulong()); }
 
@@ -0,0 +1,1991 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+//   Parts based on magic_enum <https://github.com/Neargye/magic_enum>
+//   Copyright (c) 2019 - 2024 Daniil Goncharov <neargye@gmail.com>.
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//----------------------------------------------------------------------------------------
+// conjure_enum_core
+// Configuration, compiler specifics, range customisation and enum probing shared with
+// conjure_enum, and conjure_enum_core<T> offering enum_to_string, string_to_enum, contains
+// and index. Depends only on <source_location>, <string_view>, <cstddef>, <cstdint>,
+// <type_traits> and <utility>; include this instead of conjure_enum.hpp where only these
+// lookups are needed.
+//----------------------------------------------------------------------------------------
+#ifndef FIX8_CONJURE_ENUM_CORE_HPP_
+#define FIX8_CONJURE_ENUM_CORE_HPP_
+
+#if defined _MSC_VER && (_MSC_VER < 1910) || !defined _MSC_VER && (__cplusplus < 202002L)
+# error "conjure_enum requires C++20 support"
+#endif
+
+//----------------------------------------------------------------------------------------
+#if defined FIX8_CONJURE_ENUM_ALL_OPTIMIZATIONS
+# if not defined FIX8_CONJURE_ENUM_IS_CONTINUOUS
+#  define FIX8_CONJURE_ENUM_IS_CONTINUOUS
+# endif
+# if not defined FIX8_CONJURE_ENUM_NO_ANON
+#  define FIX8_CONJURE_ENUM_NO_ANON
+# endif
+# if not defined FIX8_CONJURE_ENUM_MINIMAL
+#  define FIX8_CONJURE_ENUM_MINIMAL
+# endif
+#endif
+
+//-----------------------------------------------------------------------------------------
+#include <source_location>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <fix8/conjure_enum_macros.hpp>
+
+//-----------------------------------------------------------------------------------------
+// defined as export by the module interface unit (modules/conjure_enum.cppm)
+//-----------------------------------------------------------------------------------------
+#if not defined FIX8_CONJURE_ENUM_EXPORT
+# define FIX8_CONJURE_ENUM_EXPORT
+#endif
+
+//-----------------------------------------------------------------------------------------
+// forces the run time lookups and their helpers inline, so that unoptimized (-O0, -Og) builds
+// do not make a call for every table read and word load; define as empty to leave it to the compiler
+//-----------------------------------------------------------------------------------------
+#if not defined FIX8_CONJURE_ENUM_INLINE
+# if defined __GNUC__ || defined __clang__
+#  define FIX8_CONJURE_ENUM_INLINE [[gnu::always_inline]]
+# else
+#  define FIX8_CONJURE_ENUM_INLINE
+# endif
+#endif
+#if (defined __GNUC__ || defined __clang__) && defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+# define FIX8_CONJURE_ENUM_NATIVE_LOADS // words are read with __builtin_memcpy at run time
+#endif
+
+//-----------------------------------------------------------------------------------------
+namespace FIX8 {
+
+//-----------------------------------------------------------------------------------------
+// global default enum range
+//-----------------------------------------------------------------------------------------
+#if not defined FIX8_CONJURE_ENUM_MIN_VALUE
+# define FIX8_CONJURE_ENUM_MIN_VALUE -128
+#endif
+#if not defined FIX8_CONJURE_ENUM_MAX_VALUE
+# define FIX8_CONJURE_ENUM_MAX_VALUE 127
+#endif
+
+//-----------------------------------------------------------------------------------------
+// number of enum values reported by a single epeek_batch instantiation
+// (used when FIX8_CONJURE_ENUM_BATCH_PROBE is defined and by automatic range discovery)
+//-----------------------------------------------------------------------------------------
+#if not defined FIX8_CONJURE_ENUM_BATCH_SIZE
+# define FIX8_CONJURE_ENUM_BATCH_SIZE 64
+#endif
+
+//-----------------------------------------------------------------------------------------
+// automatic range discovery defaults; the search is clamped to +/- FIX8_CONJURE_ENUM_AUTO_RANGE_LIMIT
+// and stops after FIX8_CONJURE_ENUM_AUTO_RANGE_GAP consecutive values without an enumerator. A gap
+// of 0 means none was given: discovery must then reach the search limits or compilation fails
+//-----------------------------------------------------------------------------------------
+#if not defined FIX8_CONJURE_ENUM_AUTO_RANGE_LIMIT
+# define FIX8_CONJURE_ENUM_AUTO_RANGE_LIMIT 32767
+#endif
+#if not defined FIX8_CONJURE_ENUM_AUTO_RANGE_GAP
+# define FIX8_CONJURE_ENUM_AUTO_RANGE_GAP 0
+#endif
+
+//-----------------------------------------------------------------------------------------
+// enums whose probe range is wider than this use large enum mode (see enum_large_range)
+//-----------------------------------------------------------------------------------------
+#if not defined FIX8_CONJURE_ENUM_LARGE_THRESHOLD
+# define FIX8_CONJURE_ENUM_LARGE_THRESHOLD 1024
+#endif
+
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<std::size_t N>
+class fixed_string final
+{
+	const char _buff[N + 1];
+	template<std::size_t... I>
+	constexpr fixed_string(std::string_view sv, std::index_sequence<I...>) noexcept : _buff{sv[I]..., 0} {}
+
+public:
+	explicit constexpr fixed_string(std::string_view sv) noexcept : fixed_string{sv, std::make_index_sequence<N>{}} {}
+	constexpr fixed_string() = delete;
+	constexpr std::string_view get() const noexcept { return { _buff, N }; }
+	constexpr const char *c_str() const noexcept { return _buff; }
+	constexpr operator std::string_view() const noexcept { return get(); }
+	constexpr char operator[](size_t idx) const noexcept { return _buff[idx]; }
+	constexpr std::size_t size() const noexcept { return N + 1; }
+	friend std::ostream& operator<<(std::ostream& os, const fixed_string& what) noexcept { return os << what.get(); }
+};
+
+//-----------------------------------------------------------------------------------------
+// fixed size array used for the core tables in place of std::array
+//-----------------------------------------------------------------------------------------
+template<typename V, std::size_t N>
+struct fixed_array
+{
+	V _arr[N ? N : 1];
+
+	FIX8_CONJURE_ENUM_INLINE constexpr std::size_t size() const noexcept { return N; }
+	FIX8_CONJURE_ENUM_INLINE constexpr V& operator[](std::size_t idx) noexcept { return _arr[idx]; }
+	FIX8_CONJURE_ENUM_INLINE constexpr const V& operator[](std::size_t idx) const noexcept { return _arr[idx]; }
+	FIX8_CONJURE_ENUM_INLINE constexpr V *begin() noexcept { return _arr; }
+	FIX8_CONJURE_ENUM_INLINE constexpr V *end() noexcept { return _arr + N; }
+	FIX8_CONJURE_ENUM_INLINE constexpr const V *begin() const noexcept { return _arr; }
+	FIX8_CONJURE_ENUM_INLINE constexpr const V *end() const noexcept { return _arr + N; }
+};
+
+//-----------------------------------------------------------------------------------------
+// minimal optional returned by conjure_enum_core; conjure_enum returns std::optional
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename V>
+class core_optional final
+{
+	V _val{};
+	bool _engaged{};
+
+public:
+	constexpr core_optional() noexcept = default;
+	FIX8_CONJURE_ENUM_INLINE constexpr core_optional(V val) noexcept : _val{val}, _engaged{true} {}
+	FIX8_CONJURE_ENUM_INLINE constexpr bool has_value() const noexcept { return _engaged; }
+	FIX8_CONJURE_ENUM_INLINE constexpr explicit operator bool() const noexcept { return _engaged; }
+	FIX8_CONJURE_ENUM_INLINE constexpr const V& operator*() const noexcept { return _val; }
+	FIX8_CONJURE_ENUM_INLINE constexpr const V *operator->() const noexcept { return &_val; }
+	FIX8_CONJURE_ENUM_INLINE constexpr V value_or(V other) const noexcept { return _engaged ? _val : other; }
+	constexpr bool operator==(const core_optional&) const noexcept = default;
+	friend constexpr bool operator==(const core_optional& pl, const V& pr) noexcept { return pl._engaged && pl._val == pr; }
+};
+
+//-----------------------------------------------------------------------------------------
+class static_only
+{
+protected:
+	static_only() = delete;
+#if defined _MSC_VER
+	~static_only() = default; // warning C4624
+#else
+	~static_only() = delete;
+#endif
+	static_only(const static_only&) = delete;
+	static_only& operator=(const static_only&) = delete;
+	static_only(static_only&&) = delete;
+	static_only& operator=(static_only&&) = delete;
+};
+
+//-----------------------------------------------------------------------------------------
+// compiler specifics
+//-----------------------------------------------------------------------------------------
+class cs final : public static_only
+{
+	struct _spec
+	{
+		std::string_view start;
+		char end;
+		std::string_view anon_str;
+		char anon_start;
+	};
+
+	static constexpr _spec _specifics[]
+	{
+#if defined __clang__
+		{ "e = ", ']', "(anonymous namespace)", '(' }, { "T = ", ']', "(anonymous namespace)", '(' },
+		{ "e = <", '>', "(anonymous namespace)", '(' },
+#elif defined __GNUC__
+		{ "e = ", ';', "<unnamed>", '<' }, { "T = ", ']', "{anonymous}", '{' },
+		{ "e = {", '}', "<unnamed>", '<' },
+#elif defined _MSC_VER
+		{ "epeek<", '>', "`anonymous-namespace'", '`' }, { "::tpeek", '<', "enum `anonymous namespace'::", '\0' },
+		{ "epeek_batch<", '>', "`anonymous-namespace'", '`' },
+		{ "", '\0', "`anonymous namespace'::", '\0' }, { "", '\0', "enum ", '\0' }, { "", '\0', "class ", '\0' },
+		{ "", '\0', "struct ", '\0' },
+#else
+# error "conjure_enum not supported by your compiler"
+#endif
+	};
+
+public:
+	enum class stype { enum_t, type_t, batch_t, extype_t0, extype_t1, extype_t2, extype_t3 };
+	enum class sval { start, end, anon_str, anon_start };
+
+	template<sval N, stype V>
+	static constexpr auto get_spec() noexcept
+	{
+		constexpr const auto& spec { _specifics[static_cast<int>(V)] };
+		if constexpr (N == sval::start)
+			return spec.start;
+		else if constexpr (N == sval::end)
+			return spec.end;
+		else if constexpr (N == sval::anon_str)
+			return spec.anon_str;
+		else
+			return spec.anon_start;
+	}
+	static constexpr auto size() noexcept { return sizeof(_specifics); }
+
+	/// view of a function_name() string, and the position of the first of chars in such a view at or after pos.
+	/// gcc folds these builtins in constant evaluation (clang only strlen), which costs far less than the loops
+	/// of the std::string_view equivalents on long names
+	static constexpr std::string_view view(const char *what) noexcept
+	{
+#if defined __GNUC__
+		return { what, __builtin_strlen(what) };
+#else
+		return what;
+#endif
+	}
+
+	static constexpr std::size_t find_any(std::string_view what, const char *chars, std::size_t pos) noexcept
+	{
+#if defined __GNUC__ && not defined __clang__
+		if (pos < what.size())
+			if (const char *fnd { __builtin_strpbrk(what.data() + pos, chars) }; fnd && fnd < what.data() + what.size())
+				return fnd - what.data();
+		return std::string_view::npos;
+#else
+		return what.find_first_of(chars, pos);
+#endif
+	}
+};
+using stype = cs::stype;
+using sval = cs::sval;
+
+#if defined _MSC_VER
+#define CHKMSSTR(e, x) \
+	if constexpr (constexpr auto ep##x { e.find(cs::get_spec<sval::anon_str,stype::x>()) }; ep##x != std::string_view::npos) \
+		return e.substr(ep##x + cs::get_spec<sval::anon_str,stype::x>().size(), e.size() - (ep##x + cs::get_spec<sval::anon_str,stype::x>().size()))
+#endif
+
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
+concept valid_enum = requires(T)
+{
+	requires std::is_same_v<T, std::decay_t<T>>;
+	requires std::is_enum_v<T>;
+};
+
+//-----------------------------------------------------------------------------------------
+// NUL terminated strings passed as char pointers. String literals and char arrays deduce as
+// arrays, not pointers, so they still convert to std::string_view
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename C>
+concept c_string = std::is_same_v<C, const char *> || std::is_same_v<C, char *>;
+
+//-----------------------------------------------------------------------------------------
+// Derive enum_range<T> from this class to have conjure_enum discover the populated range
+// of your enum at compile time. min and max are the search limits: the limits of the underlying
+// type clamped to +/- FIX8_CONJURE_ENUM_AUTO_RANGE_LIMIT. Discovery stops once auto_gap consecutive
+// values have no enumerator; enums with an 8 bit underlying type are always fully searched. Wider
+// enums must be given a gap, since enumerators beyond it cannot be seen; without one (gap 0)
+// discovery stops after an empty window and fails to compile if the search limits were not reached.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T, int gap=FIX8_CONJURE_ENUM_AUTO_RANGE_GAP>
+struct enum_auto_range
+{
+	using U = std::underlying_type_t<T>;
+	static constexpr long long type_max { (1LL << (sizeof(U) < sizeof(int) ? sizeof(U) * 8 - std::is_signed_v<U> : 31)) - 1 };
+	static constexpr long long limit { FIX8_CONJURE_ENUM_AUTO_RANGE_LIMIT };
+	static constexpr bool auto_range{true};
+	static constexpr int min { std::is_signed_v<U> ? static_cast<int>(-type_max - 1 > -1LL - limit ? -type_max - 1 : -1LL - limit) : 0 },
+		max { static_cast<int>(type_max < limit ? type_max : limit) };
+	static constexpr bool explicit_gap { sizeof(U) == 1 || gap > 0 };
+	static constexpr int auto_gap { sizeof(U) == 1 ? max - min + 1 : gap > 0 ? gap : FIX8_CONJURE_ENUM_BATCH_SIZE };
+};
+
+//-----------------------------------------------------------------------------------------
+// Derive enum_range<T> from this class to reflect a bit flag enum. Only zero and the single bit
+// values of the underlying type are probed; min and max are probe indices, where index 0 is
+// zero and index n is the value 1 << (n - 1).
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
+struct enum_flags_range
+{
+	static constexpr bool flags{true};
+	static constexpr int min{0}, max{static_cast<int>(sizeof(T) * 8)};
+};
+
+//-----------------------------------------------------------------------------------------
+// Derive enum_range<T> from this class to reflect an enum with thousands of enumerators.
+// The range is scanned in batch windows and the tables are built with loops and a merge
+// sort rather than pack expansions. Ranges wider than FIX8_CONJURE_ENUM_LARGE_THRESHOLD
+// use this mode regardless.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T, int minv, int maxv>
+struct enum_large_range
+{
+	static constexpr bool large{true};
+	static constexpr int min{minv}, max{maxv};
+};
+
+//-----------------------------------------------------------------------------------------
+// Derive enum_range<T> from this class to reflect only the listed values of T. Use this for
+// enums with sparse or 64 bit values that no int range could cover; the cost is proportional
+// to the number of values listed, not their magnitude. Values may be listed in any order and
+// aliases are ignored. min and max are probe indices into values, which is sorted.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T, T... e>
+struct enum_values_range
+{
+	static_assert(sizeof...(e) > 0, "enum_values_range requires at least one value");
+
+private:
+	struct _unique
+	{
+		fixed_array<T, sizeof...(e)> vals;
+		std::size_t cnt;
+	};
+
+	/// insertion sort, dropping duplicates
+	static constexpr _unique _sort() noexcept
+	{
+		const T from[] { e... };
+		_unique result{};
+		for (const T val : from)
+		{
+			std::size_t pos { result.cnt };
+			for (; pos > 0 && val < result.vals[pos - 1]; --pos);
+			if (pos > 0 && result.vals[pos - 1] == val)
+				continue;
+			for (std::size_t idx { result.cnt++ }; idx > pos; --idx)
+				result.vals[idx] = result.vals[idx - 1];
+			result.vals[pos] = val;
+		}
+		return result;
+	}
+
+	static constexpr _unique _sorted { _sort() };
+
+	static constexpr auto _values() noexcept
+	{
+		fixed_array<T, _sorted.cnt> result{};
+		for (std::size_t idx{}; idx < result.size(); ++idx)
+			result[idx] = _sorted.vals[idx];
+		return result;
+	}
+
+public:
+	static constexpr bool declared{true};
+	static constexpr auto values { _values() };
+	static constexpr int min{0}, max{static_cast<int>(values.size()) - 1};
+};
+
+//-----------------------------------------------------------------------------------------
+// Specialise this class (see FIX8_CONJURE_ENUM_SET_TRAITS) to select the optimizations for T
+// alone, rather than for every enum with the global macros. Each member is optional:
+//   continuous - every value in the range of T is an enumerator, so none are probed (FIX8_CONJURE_ENUM_IS_CONTINUOUS)
+//   no_anon    - T is not declared in an anonymous namespace (FIX8_CONJURE_ENUM_NO_ANON)
+//   extended   - build names, unscoped_names and the scoped entry tables (false is
+//                FIX8_CONJURE_ENUM_MINIMAL); when false the unscoped and scope API is not available
+//   min, max   - the range of T, as enum_range<T>; an enum_range<T> specialisation takes precedence
+// An absent member takes the global setting; a present one overrides it either way, except that
+// extended cannot enable the tables when FIX8_CONJURE_ENUM_MINIMAL is defined.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
+struct enum_traits
+{
+};
+
+//-----------------------------------------------------------------------------------------
+// You can specialise this class to define a custom range for your enum
+// Alternatively, alias T::ce_first as the first and T::ce_last as the last enum in
+// your enum declaration
+// If FIX8_CONJURE_ENUM_AUTO_RANGE is defined, enums without a range use automatic range discovery
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
+class enum_range final : public static_only
+{
+	static constexpr bool _traits_range { requires { enum_traits<T>::min; enum_traits<T>::max; } };
+	static constexpr int get_first() noexcept requires _traits_range { return enum_traits<T>::min; }
+	static constexpr int get_last() noexcept requires _traits_range { return enum_traits<T>::max; }
+	static constexpr bool get_auto() noexcept requires _traits_range { return false; }
+	static constexpr int get_first() noexcept requires (!_traits_range && std::is_enum_v<decltype(T::ce_first)>)
+		{ return static_cast<int>(T::ce_first); }
+	static constexpr int get_last() noexcept requires (!_traits_range && std::is_enum_v<decltype(T::ce_last)>)
+		{ return static_cast<int>(T::ce_last); }
+	static constexpr bool get_auto() noexcept requires (!_traits_range && std::is_enum_v<decltype(T::ce_first)>) { return false; }
+#if defined FIX8_CONJURE_ENUM_AUTO_RANGE
+	static constexpr int get_first() noexcept { return enum_auto_range<T>::min; }
+	static constexpr int get_last() noexcept { return enum_auto_range<T>::max; };
+	static constexpr bool get_auto() noexcept { return true; }
+	static constexpr int get_gap() noexcept { return enum_auto_range<T>::auto_gap; }
+	static constexpr bool get_explicit_gap() noexcept { return enum_auto_range<T>::explicit_gap; }
+#else
+	static constexpr int get_first() noexcept { return FIX8_CONJURE_ENUM_MIN_VALUE; }
+	static constexpr int get_last() noexcept { return FIX8_CONJURE_ENUM_MAX_VALUE; };
+	static constexpr bool get_auto() noexcept { return false; }
+	static constexpr int get_gap() noexcept { return FIX8_CONJURE_ENUM_BATCH_SIZE; }
+	static constexpr bool get_explicit_gap() noexcept { return false; }
+#endif
+
+public:
+	static constexpr int min{get_first()}, max{get_last()};
+	static constexpr bool auto_range{get_auto()};
+	static constexpr int auto_gap{get_gap()};
+	static constexpr bool explicit_gap{get_explicit_gap()};
+};
+
+//-----------------------------------------------------------------------------------------
+// Specialised by headers written by conjure_enum_gen (see conjure_enum_gen.hpp). When
+// present, values and names are taken from this class and the enum is not probed.
+// values must be sorted and names must be in the same order; the optional sorted member
+// holds the indices of names in name order.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
+struct enum_cache
+{
+};
+
+//-----------------------------------------------------------------------------------------
+// How conjure_enum_core<T> finds a value (index, contains, enum_to_string) and a name
+// (string_to_enum, contains), as reported by conjure_enum_core<T>::strategy(). Bytes count the
+// lookup tables, but not the value and name tables;
+// probes count the table reads of a hit on the general path, including the final comparison.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT enum class value_lookup { continuous, direct, hash };
+FIX8_CONJURE_ENUM_EXPORT enum class name_lookup { slots, keys };
+
+FIX8_CONJURE_ENUM_EXPORT struct lookup_strategy
+{
+	value_lookup values;
+	name_lookup names;
+	std::size_t value_bytes, name_bytes, value_probes, name_probes;
+	constexpr bool operator==(const lookup_strategy&) const noexcept = default;
+};
+
+//-----------------------------------------------------------------------------------------
+// Probes T and builds its value and name tables; provides the core lookups with hand rolled
+// searches. conjure_enum<T> derives from this class and adds the std::array/std::tuple tables
+// and the rest of the API.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<valid_enum T>
+class conjure_enum_core : public static_only
+{
+protected:
+	static constexpr int _search_min{enum_range<T>::min}, _search_max{enum_range<T>::max};
+	static constexpr bool _auto_range { requires { requires enum_range<T>::auto_range; } };
+	static constexpr bool _flags { requires { requires enum_range<T>::flags; } };
+	static constexpr bool _declared { requires { requires enum_range<T>::declared; } };
+	static_assert(_search_max > _search_min || _declared,
+		"FIX8_CONJURE_ENUM_MAX_VALUE, enum_range<T>::max or T::ce_last must be greater than FIX8_CONJURE_ENUM_MIN_VALUE, enum_range<T>::min or T::ce_first) ");
+	static constexpr bool _cached { requires { enum_cache<T>::values; enum_cache<T>::names; } };
+	/// per enum optimizations; enum_traits<T> members override the global macros in either direction
+#if defined FIX8_CONJURE_ENUM_IS_CONTINUOUS
+	static constexpr bool _continuous { !requires { requires !enum_traits<T>::continuous; } };
+#else
+	static constexpr bool _continuous { requires { requires enum_traits<T>::continuous; } };
+#endif
+#if defined FIX8_CONJURE_ENUM_NO_ANON
+	static constexpr bool _no_anon { !requires { requires !enum_traits<T>::no_anon; } };
+#else
+	static constexpr bool _no_anon { requires { requires enum_traits<T>::no_anon; } };
+#endif
+#if defined FIX8_CONJURE_ENUM_MINIMAL
+	static constexpr bool _extended { requires { requires enum_traits<T>::extended; } };
+#else
+	static constexpr bool _extended { !requires { requires !enum_traits<T>::extended; } };
+#endif
+	using _flag_type = std::make_unsigned_t<std::underlying_type_t<T>>;
+#if defined FIX8_CONJURE_ENUM_BATCH_PROBE
+	static constexpr bool _batch_probe { true };
+#else
+	static constexpr bool _batch_probe { _auto_range || _declared };
+#endif
+
+	template<typename V>
+	static constexpr V _min(V pl, V pr) noexcept { return pr < pl ? pr : pl; }
+	template<typename V>
+	static constexpr V _max(V pl, V pr) noexcept { return pl < pr ? pr : pl; }
+
+public:
+	template<T e>
+	static consteval const char *epeek() noexcept { return std::source_location::current().function_name(); }
+
+	template<T... e>
+	static consteval const char *epeek_batch() noexcept { return std::source_location::current().function_name(); }
+
+protected:
+	template<T e>
+	static constexpr std::string_view _epeek_v { epeek<e>() };
+
+	/// batched probing; each epeek_batch reports the values F..L of one window in one string. Windows are
+	/// aligned on multiples of _batch_size, so range discovery and the final scan share instantiations
+	static constexpr int _batch_size { FIX8_CONJURE_ENUM_BATCH_SIZE };
+	static_assert(_batch_size > 0, "FIX8_CONJURE_ENUM_BATCH_SIZE must be greater than 0");
+
+	static constexpr int _window(int val) noexcept { return val - (val % _batch_size + _batch_size) % _batch_size; }
+
+	/// map between probe indices and enum values; these are the same unless T is a flags enum or has declared values
+	static constexpr T _probe_value(int idx) noexcept
+	{
+		if constexpr (_flags)
+			return idx ? static_cast<T>(static_cast<_flag_type>(1) << (idx - 1)) : T{};
+		else if constexpr (_declared)
+			return enum_range<T>::values[idx];
+		else
+			return static_cast<T>(idx);
+	}
+
+	static constexpr int _probe_index(T value) noexcept
+	{
+		if constexpr (_flags)
+		{
+			auto uval { static_cast<_flag_type>(value) };
+			if (uval & (uval - 1)) // not a single bit
+				return -1;
+			int idx{};
+			for (; uval; uval >>= 1)
+				++idx;
+			return idx;
+		}
+		else if constexpr (_declared)
+		{
+			const auto& vals { enum_range<T>::values };
+			for (std::size_t lo{}, hi { vals.size() }; lo < hi;)
+			{
+				const auto mid { lo + (hi - lo) / 2 };
+				if (vals[mid] < value)
+					lo = mid + 1;
+				else if (value < vals[mid])
+					hi = mid;
+				else
+					return static_cast<int>(mid);
+			}
+			return -1;
+		}
+		else
+			return static_cast<int>(value);
+	}
+
+	template<int F, std::size_t... I>
+	static consteval const char *_epeek_batch(std::index_sequence<I...>) noexcept
+	{
+		return epeek_batch<_probe_value(F + static_cast<int>(I))...>();
+	}
+
+	template<int F, int L>
+	static constexpr std::string_view _epeek_batch_v { _epeek_batch<F>(std::make_index_sequence<L - F + 1>()) };
+
+	static constexpr std::string_view _batch_element(std::string_view what) noexcept
+	{
+		if constexpr (!_no_anon)
+			if (what.starts_with(cs::get_spec<sval::anon_str,stype::batch_t>()))
+				return what.substr(cs::get_spec<sval::anon_str,stype::batch_t>().size() + 2); // eat "::"
+		return what;
+	}
+
+	/// Split a batch string into its element names; casts (invalid values) are left empty. Raw pointers and
+	/// skipping the repeated cast prefix keep the number of constexpr operations per element small.
+	static constexpr auto _batch_names(std::string_view from) noexcept
+	{
+		fixed_array<std::string_view, _batch_size> result{};
+		const auto ep { from.find(cs::get_spec<sval::start,stype::batch_t>()) };
+		if (ep == std::string_view::npos)
+			return result;
+		constexpr auto is_open([](char c) noexcept { return c == '(' || c == '<' || c == '{' || c == '['; });
+		constexpr auto is_close([](char c) noexcept { return c == ')' || c == '>' || c == '}' || c == ']'; });
+		const char *ptr { from.data() + ep + cs::get_spec<sval::start,stype::batch_t>().size() }, *const eptr { from.data() + from.size() };
+		for (std::size_t idx{}, cast_len{}; idx < result.size() && ptr < eptr && !is_close(*ptr); ++idx)
+		{
+			const char *st { ptr };
+#if defined __clang__
+			if (*ptr == '(' && (_no_anon || !std::string_view(ptr, eptr - ptr).starts_with(cs::get_spec<sval::anon_str,stype::batch_t>())))
+#else
+			if (*ptr == '(')
+#endif
+			{
+				if (!cast_len) // all casts in a batch share the same "(type)" prefix
+				{
+					for (std::size_t depth{}; ptr < eptr; ++ptr)
+						if (is_open(*ptr))
+							++depth;
+						else if (is_close(*ptr) && --depth == 0)
+							break;
+					cast_len = ptr - st + 1;
+				}
+				for (ptr = st + cast_len; ptr < eptr && *ptr != ',' && !is_close(*ptr); ++ptr);
+			}
+			else
+			{
+				for (std::size_t depth{}; ptr < eptr; ++ptr)
+				{
+					if (is_open(*ptr))
+						++depth;
+					else if (is_close(*ptr))
+					{
+						if (depth == 0)
+							break;
+						--depth;
+					}
+					else if (*ptr == ',' && depth == 0)
+						break;
+				}
+				result[idx] = _batch_element({ st, static_cast<std::size_t>(ptr - st) });
+			}
+			if (ptr < eptr && *ptr == ',')
+				++ptr;
+			while (ptr < eptr && *ptr == ' ')
+				++ptr;
+		}
+		return result;
+	}
+
+	template<int F, int L>
+	static constexpr auto _batch_names_v { _batch_names(_epeek_batch_v<F, L>) };
+
+	/// first and last value of the window containing val, clipped to the probe range
+	static constexpr int _batch_first(int val) noexcept { return _max(_window(val), enum_min_value); }
+	static constexpr int _batch_last(int val) noexcept { return _min(_window(val) + _batch_size - 1, enum_max_value); }
+
+	template<std::size_t... I>
+	static constexpr auto _batch_valid(std::index_sequence<I...>) noexcept
+	{
+		return fixed_array<bool, sizeof...(I)>{{ !_batch_names_v<_batch_first(enum_min_value + static_cast<int>(I)),
+			_batch_last(enum_min_value + static_cast<int>(I))>[enum_min_value + I - _batch_first(enum_min_value + static_cast<int>(I))].empty()... }};
+	}
+
+	/// automatic range discovery; windows are scanned outward from zero in each direction until auto_gap
+	/// values without an enumerator follow the last populated window. Until an enumerator has been found
+	/// the scan continues to the search limit. gapped is set when a scan stopped on the gap.
+	struct _window_span { int first, last; bool found, gapped{}; };
+
+	template<int S>
+	static constexpr bool _window_populated() noexcept
+	{
+		for (const auto& name : _batch_names_v<_max(S, _search_min), _min(S + _batch_size - 1, _search_max)>)
+			if (!name.empty())
+				return true;
+		return false;
+	}
+
+	template<int S, int D, int first, int last, bool found>
+	static constexpr _window_span _discover() noexcept
+	{
+		if constexpr (S > _search_max || S + _batch_size - 1 < _search_min)
+			return { first, last, found };
+		else if constexpr (_window_populated<S>())
+			return _discover<S + D, D, found ? first : S, S, true>();
+		else if constexpr (found && (D > 0 ? S - last : last - S) >= enum_range<T>::auto_gap)
+			return { first, last, found, true };
+		else
+			return _discover<S + D, D, first, last, found>();
+	}
+
+	static constexpr _window_span _probe_range() noexcept
+	{
+		if constexpr (_auto_range)
+		{
+			constexpr int origin { _window(_max(_search_min, _min(0, _search_max))) };
+			constexpr auto upper { _discover<origin, _batch_size, origin, origin, false>() };
+			// zero counts as populated for the downward scan if the upward scan found anything
+			constexpr auto lower { _discover<origin - _batch_size, -_batch_size, origin, origin, upper.found>() };
+			static_assert(!(upper.gapped || lower.gapped) || !requires { requires !enum_range<T>::explicit_gap; },
+				"conjure_enum: automatic range discovery stopped short of the search limits without a gap; enumerators beyond it"
+				" would be lost. Give a gap (enum_auto_range<T, gap>, FIX8_CONJURE_ENUM_SET_AUTO_RANGE_GAP or"
+				" FIX8_CONJURE_ENUM_AUTO_RANGE_GAP) or set a range");
+			if constexpr (!upper.found && !lower.found)
+				return { _search_min, _search_max, false }; // empty enum, reported below
+			else
+				return { _max(lower.last < origin ? lower.last : upper.first, _search_min),
+					_min((upper.found ? upper.last : lower.first) + _batch_size - 1, _search_max), true };
+		}
+		else
+			return { _search_min, _search_max, true };
+	}
+
+	static constexpr int enum_min_value { _probe_range().first }, enum_max_value { _probe_range().last };
+	static constexpr bool _large { requires { requires enum_range<T>::large; }
+		|| static_cast<long long>(enum_max_value) - enum_min_value >= FIX8_CONJURE_ENUM_LARGE_THRESHOLD };
+
+	/// large enums; the probe range is scanned one batch window at a time into a single array of names by
+	/// probe index, from which values and names are built with loops rather than pack expansions
+	template<int S>
+	static constexpr bool _scan_window(auto& result) noexcept
+	{
+		constexpr int first { _batch_first(S) }, last { _batch_last(S) };
+		for (int idx{first}; idx <= last; ++idx)
+			result[idx - enum_min_value] = _batch_names_v<first, last>[idx - first];
+		return true;
+	}
+
+	template<std::size_t... W>
+	static constexpr auto _scan(std::index_sequence<W...>) noexcept
+	{
+		fixed_array<std::string_view, enum_max_value - enum_min_value + 1> result{};
+		[[maybe_unused]] const bool done[] { _scan_window<_window(enum_min_value) + static_cast<int>(W) * _batch_size>(result)... };
+		return result;
+	}
+
+	template<int F, int L>
+	static constexpr auto _scan_v { _scan(std::make_index_sequence<(_window(L) - _window(F)) / _batch_size + 1>()) };
+
+	static constexpr std::size_t _scan_count() noexcept
+	{
+		std::size_t cnt{};
+		for (const auto& name : _scan_v<enum_min_value, enum_max_value>)
+			cnt += !name.empty();
+		return cnt;
+	}
+
+	static constexpr auto _large_values() noexcept
+	{
+		constexpr const auto& scan { _scan_v<enum_min_value, enum_max_value> };
+		constexpr auto valid_cnt { _scan_count() };
+		static_assert(valid_cnt > 0, "conjure_enum requires non-empty enum");
+		fixed_array<T, valid_cnt> vals{};
+		for(std::size_t idx{}, nn{}; nn < valid_cnt; ++idx)
+			if (!scan[idx].empty())
+				vals[nn++] = _probe_value(enum_min_value + static_cast<int>(idx));
+		return vals;
+	}
+
+	template<T e>
+	static constexpr bool _is_valid() noexcept
+	{
+		if constexpr (constexpr auto ep { _epeek_v<e>.rfind(cs::get_spec<sval::start,stype::enum_t>()) }; ep == std::string_view::npos)
+			return false;
+#if defined __clang__
+		else if constexpr (_epeek_v<e>[ep + cs::get_spec<sval::start,stype::enum_t>().size()] == '(')
+		{
+			if constexpr (_epeek_v<e>[ep + cs::get_spec<sval::start,stype::enum_t>().size() + 1] == '(')
+				return false;
+			if constexpr (!_no_anon
+				&& _epeek_v<e>.find(cs::get_spec<sval::anon_str,stype::enum_t>(), ep + cs::get_spec<sval::start,stype::enum_t>().size()) != std::string_view::npos)	// is anon
+				return true;
+		}
+		else if constexpr (_epeek_v<e>.find_first_of(cs::get_spec<sval::end,stype::enum_t>(), ep + cs::get_spec<sval::start,stype::enum_t>().size()) != std::string_view::npos)
+			return true;
+		return false;
+#else
+		else if constexpr (_epeek_v<e>[ep + cs::get_spec<sval::start,stype::enum_t>().size()] != '('
+			&& _epeek_v<e>.find_first_of(cs::get_spec<sval::end,stype::enum_t>(), ep + cs::get_spec<sval::start,stype::enum_t>().size()) != std::string_view::npos)
+				return true;
+		else
+			return false;
+#endif
+	}
+
+	static constexpr auto _values() noexcept
+	{
+		if constexpr (_cached)
+			return enum_cache<T>::values;
+		else if constexpr (_large)
+			return _large_values();
+		else
+			return _values(std::make_index_sequence<enum_max_value - enum_min_value + 1>());
+	}
+
+	template<std::size_t... I>
+	static constexpr auto _values(std::index_sequence<I...>) noexcept
+	{
+		if constexpr (_continuous && !_auto_range && !_flags && !_declared) // discovered ranges are rounded to whole windows
+		{
+			static_assert(sizeof...(I) > 0, "conjure_enum requires non-empty enum");
+			return fixed_array<T, sizeof...(I)>{{ static_cast<T>(enum_min_value + I)... }};
+		}
+		else
+		{
+			constexpr auto valid { _valid(std::index_sequence<I...>()) };
+			constexpr auto valid_cnt { _valid_count(valid) };
+			static_assert(valid_cnt > 0, "conjure_enum requires non-empty enum");
+			fixed_array<T, valid_cnt> vals{};
+			for(std::size_t idx{}, nn{}; nn < valid_cnt; ++idx)
+				if (valid[idx])
+					vals[nn++] = _probe_value(enum_min_value + static_cast<int>(idx));
+			if constexpr (_flags) // a signed underlying type puts the top bit first
+			{
+				for (std::size_t idx{1}; idx < vals.size(); ++idx)
+				{
+					const T val { vals[idx] };
+					std::size_t pos{idx};
+					for (; pos > 0 && val < vals[pos - 1]; --pos)
+						vals[pos] = vals[pos - 1];
+					vals[pos] = val;
+				}
+			}
+			return vals;
+		}
+	}
+
+	template<std::size_t... I>
+	static constexpr auto _valid(std::index_sequence<I...> seq) noexcept
+	{
+		if constexpr (_batch_probe)
+			return _batch_valid(seq);
+		else
+			return fixed_array<bool, sizeof...(I)>{{ _is_valid<_probe_value(enum_min_value + static_cast<int>(I))>()... }};
+	}
+
+	static constexpr std::size_t _valid_count(const auto& valid) noexcept
+	{
+		std::size_t cnt{};
+		for (const bool val : valid)
+			cnt += val;
+		return cnt;
+	}
+
+	template<T e>
+	static constexpr std::string_view _get_name() noexcept
+	{
+		if constexpr (_cached)
+		{
+			const auto& cvals { enum_cache<T>::values };
+			std::size_t lo{};
+			for (std::size_t len { cvals.size() }; len;)
+			{
+				const auto half { len / 2 };
+				if (cvals[lo + half] < e)
+				{
+					lo += half + 1;
+					len -= half + 1;
+				}
+				else
+					len = half;
+			}
+			return lo < cvals.size() && cvals[lo] == e ? enum_cache<T>::names[lo] : std::string_view();
+		}
+		else if constexpr (constexpr int val { _probe_index(e) }; (_batch_probe || _large) && val >= enum_min_value && val <= enum_max_value)
+			return _batch_names_v<_batch_first(val), _batch_last(val)>[val - _batch_first(val)];
+		else
+			return _get_name_single<e>();
+	}
+
+	template<T e>
+	static constexpr std::string_view _get_name_single() noexcept
+	{
+		constexpr auto ep { _epeek_v<e>.rfind(cs::get_spec<sval::start,stype::enum_t>()) };
+		if constexpr (ep == std::string_view::npos)
+			return {};
+		if constexpr (!_no_anon && _epeek_v<e>[ep + cs::get_spec<sval::start,stype::enum_t>().size()] == cs::get_spec<sval::anon_start,stype::enum_t>())
+		{
+#if defined __clang__
+			if constexpr (_epeek_v<e>[ep + cs::get_spec<sval::start,stype::enum_t>().size() + 1] == cs::get_spec<sval::anon_start,stype::enum_t>())
+				return {};
+#endif
+			if (constexpr auto lstr { _epeek_v<e>.substr(ep + cs::get_spec<sval::start,stype::enum_t>().size()) };
+				lstr.find(cs::get_spec<sval::anon_str,stype::enum_t>()) != std::string_view::npos)	// is anon
+					if constexpr (constexpr auto lc { lstr.find_first_of(cs::get_spec<sval::end,stype::enum_t>()) }; lc != std::string_view::npos)
+						return lstr.substr(cs::get_spec<sval::anon_str,stype::enum_t>().size() + 2, lc - (cs::get_spec<sval::anon_str,stype::enum_t>().size() + 2)); // eat "::"
+		}
+		constexpr std::string_view result { _epeek_v<e>.substr(ep + cs::get_spec<sval::start,stype::enum_t>().size()) };
+		if constexpr (constexpr auto lc { result.find_first_of(cs::get_spec<sval::end,stype::enum_t>()) }; lc != std::string_view::npos)
+			return result.substr(0, lc);
+		else
+			return {};
+	}
+
+	template<T e>
+	static constexpr auto _get_name_v { _get_name<e>() };
+
+	template<T e>
+	static constexpr auto _enum_name_v { fixed_string<_get_name_v<e>.size()>(_get_name_v<e>) };
+
+	/// names in value order; probed names are copied into fixed_strings so that only the names, not the
+	/// whole epeek strings, end up in the binary (large enums excepted)
+	static constexpr auto _names() noexcept
+	{
+		if constexpr (_cached)
+			return enum_cache<T>::names;
+		else if constexpr (_large)
+		{
+			constexpr const auto& scan { _scan_v<enum_min_value, enum_max_value> };
+			fixed_array<std::string_view, _enum_values.size()> result{};
+			for (std::size_t idx{}; idx < result.size(); ++idx)
+				result[idx] = scan[_probe_index(_enum_values[idx]) - enum_min_value];
+			return result;
+		}
+		else
+			return _names(std::make_index_sequence<_enum_values.size()>());
+	}
+
+	template<std::size_t... I>
+	static constexpr auto _names(std::index_sequence<I...>) noexcept
+	{
+		return fixed_array<std::string_view, sizeof...(I)>{{ _enum_name_v<_enum_values[I]>... }};
+	}
+
+	/// constexpr merge sort giving the indices of names in name order. Runs of _sort_run are insertion sorted,
+	/// then merged in passes of doubling width. Each pass is a separate constant evaluation, so no single
+	/// evaluation grows with n log n (see -fconstexpr-steps, -fconstexpr-ops-limit). Names are compared by
+	/// the 8 characters following their common prefix packed into an integer, then in full on a tie
+	static constexpr std::size_t _sort_run { 16 };
+
+	struct _sort_key
+	{
+		std::uint64_t head;
+		std::string_view name;
+	};
+
+	static constexpr std::size_t _sort_width(std::size_t sz) noexcept
+	{
+		std::size_t width { _sort_run };
+		while (width < sz)
+			width *= 2;
+		return width;
+	}
+
+	template<const auto& names, std::size_t width>
+	static constexpr auto _sort_pass() noexcept
+	{
+		constexpr std::size_t sz { names.size() };
+		constexpr const auto& keys { _sort_keys_v<names> };
+		fixed_array<std::size_t, sz> result{};
+		if constexpr (width <= _sort_run)
+		{
+			for (std::size_t lo{}; lo < sz; lo += width)
+			{
+				for (std::size_t idx{lo}, hi{_min(lo + width, sz)}; idx < hi; ++idx)
+				{
+					std::size_t pos{idx};
+					for (; pos > lo && _key_less(keys[idx], keys[result[pos - 1]]); --pos)
+						result[pos] = result[pos - 1];
+					result[pos] = idx;
+				}
+			}
+		}
+		else
+		{
+			constexpr const auto& from { _sort_pass_v<names, width / 2> };
+			for (std::size_t lo{}; lo < sz; lo += width)
+			{
+				const std::size_t mid { _min(lo + width / 2, sz) }, hi { _min(lo + width, sz) };
+				for (std::size_t left{lo}, right{mid}, out{lo}; out < hi; ++out)
+					result[out] = right == hi || (left < mid && !_key_less(keys[from[right]], keys[from[left]])) ? from[left++] : from[right++];
+			}
+		}
+		return result;
+	}
+
+	template<const auto& names, std::size_t width>
+	static constexpr auto _sort_pass_v { _sort_pass<names, width>() };
+
+	template<const auto& names>
+	static constexpr auto _sort_keys() noexcept
+	{
+		fixed_array<_sort_key, names.size()> keys{};
+		const std::string_view first { names[0] };
+		std::size_t common { first.size() };
+		for (const std::string_view name : names)
+		{
+			std::size_t pos{};
+			for (const char *fp { first.data() }, *np { name.data() }; pos < common && pos < name.size() && fp[pos] == np[pos]; ++pos);
+			common = pos;
+		}
+		for (std::size_t idx{}; idx < keys.size(); ++idx)
+		{
+			const std::string_view name { names[idx] };
+			std::uint64_t head{};
+			for (std::size_t pos{common}; pos < common + 8; ++pos)
+				head = head << 8 | (pos < name.size() ? static_cast<unsigned char>(name.data()[pos]) : 0);
+			keys[idx] = { head, name };
+		}
+		return keys;
+	}
+
+	template<const auto& names>
+	static constexpr auto _sort_keys_v { _sort_keys<names>() };
+
+	template<const auto& names>
+	static constexpr const auto& _sort_order() noexcept { return _sort_pass_v<names, _sort_width(names.size())>; }
+
+	static constexpr bool _key_less(const _sort_key& pl, const _sort_key& pr) noexcept
+	{
+		return pl.head != pr.head ? pl.head < pr.head : _name_less(pl.name, pr.name);
+	}
+
+	/// same ordering as std::string_view operator<, with fewer constexpr operations
+	static constexpr bool _name_less(std::string_view pl, std::string_view pr) noexcept
+	{
+		const char *lp { pl.data() }, *rp { pr.data() };
+		for (const char *const ep { lp + _min(pl.size(), pr.size()) }; lp < ep; ++lp, ++rp)
+			if (*lp != *rp)
+				return static_cast<unsigned char>(*lp) < static_cast<unsigned char>(*rp);
+		return pl.size() < pr.size();
+	}
+
+	/// indices of _enum_names in name order
+	static constexpr const auto& _name_order() noexcept
+	{
+		if constexpr (requires { enum_cache<T>::sorted; })
+			return enum_cache<T>::sorted;
+		else
+			return _sort_order<_enum_names>();
+	}
+
+	struct _name_entry
+	{
+		std::string_view name;
+		T value;
+	};
+
+	static constexpr auto _sorted_names() noexcept
+	{
+		constexpr const auto& order { _name_order() };
+		fixed_array<_name_entry, _enum_values.size()> result{};
+		for (std::size_t idx{}; idx < result.size(); ++idx)
+			result[idx] = { _enum_names[order[idx]], _enum_values[order[idx]] };
+		return result;
+	}
+
+	/// non continuous enums whose values span at most max(_direct_span, _direct_ratio * count()) values also get a table
+	/// indexed by value - min_v, holding the index of each value (or a sentinel) and a bitmap of the values present
+	static constexpr std::uint64_t _direct_span { 256 }, _direct_ratio { 4 };
+
+	template<typename I, std::size_t N>
+	struct _direct_table
+	{
+		static constexpr I none { static_cast<I>(~I{}) };
+		fixed_array<I, N> index;
+		fixed_array<std::uint64_t, (N + 63) / 64> present;
+	};
+
+	/// offset from min_v in the unsigned underlying type, so values below min_v wrap past the end of the table
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _value_offset(T value) noexcept
+	{
+		using U = std::make_unsigned_t<std::underlying_type_t<T>>;
+		return static_cast<U>(static_cast<U>(value) - static_cast<U>(_enum_values[0]));
+	}
+
+	static constexpr bool _use_direct() noexcept
+	{
+		const auto last { _value_offset(_enum_values[_enum_values.size() - 1]) }; // span less one; cannot overflow
+		return last + 1 != _enum_values.size() && (last < _direct_span || last < _direct_ratio * _enum_values.size());
+	}
+
+	/// values are found by their offset in a continuous range, through a direct table when the span is small enough, and
+	/// through the perfect hash of the values otherwise; every value lookup branches on this
+	static constexpr value_lookup _value_strategy() noexcept
+	{
+		if (_value_offset(_enum_values[_enum_values.size() - 1]) + 1 == _enum_values.size())
+			return value_lookup::continuous;
+		return _use_direct() ? value_lookup::direct : value_lookup::hash;
+	}
+
+	/// the smallest index type that holds sz and the sentinel
+	template<std::size_t sz, std::size_t span>
+	using _direct_table_t = _direct_table<std::conditional_t<(sz < 0xff), std::uint8_t, std::conditional_t<(sz < 0xffff), std::uint16_t, std::uint32_t>>, span>;
+
+	/// built in local arrays, which are much cheaper than element accessor calls in constant evaluation
+	template<std::size_t span>
+	static constexpr auto _make_direct() noexcept
+	{
+		constexpr std::size_t sz { _enum_values.size() }, words { (span + 63) / 64 };
+		using D = _direct_table_t<sz, span>;
+		using I = std::remove_cvref_t<decltype(D::none)>;
+		I index[span];
+		std::uint64_t present[words];
+		for (std::size_t pos{}; pos < span; ++pos)
+			index[pos] = D::none;
+		for (std::size_t pos{}; pos < words; ++pos)
+			present[pos] = 0;
+		for (std::size_t idx{}; idx < sz; ++idx)
+		{
+			const auto off { _value_offset(_enum_values[idx]) };
+			index[off] = static_cast<I>(idx);
+			present[off / 64] |= std::uint64_t{1} << off % 64;
+		}
+		D result{};
+		for (std::size_t pos{}; pos < span; ++pos)
+			result.index[pos] = index[pos];
+		for (std::size_t pos{}; pos < words; ++pos)
+			result.present[pos] = present[pos];
+		return result;
+	}
+
+	template<std::size_t span>
+	static constexpr auto _direct_v { _make_direct<span>() };
+
+	static constexpr const auto& _direct() noexcept
+	{
+		return _direct_v<_value_offset(_enum_values[_enum_values.size() - 1]) + 1>;
+	}
+
+	/// every name of an enum carries the same scope (if any), so the unscoped name starts at the same offset in each
+	static constexpr std::size_t _get_scope_size() noexcept
+	{
+		const auto name { _enum_names[0] };
+		for (std::size_t pos { name.size() }; pos; --pos)
+			if (name[pos - 1] == ':')
+				return pos;
+		return 0;
+	}
+
+	/// by _value_strategy(); returns count() if not found
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _find_value(T value) noexcept
+	{
+		if constexpr (_value_strategy() == value_lookup::continuous)
+		{
+			const auto off { _value_offset(value) };
+			return off < count() ? off : count();
+		}
+		else if constexpr (_value_strategy() == value_lookup::direct)
+		{
+			constexpr const auto& table { _direct() };
+			const auto off { _value_offset(value) };
+			return off < table.index.size() && table.index[off] != table.none ? table.index[off] : count();
+		}
+		else
+		{
+			constexpr const auto& table { _hash_v<_enum_values> };
+			const auto hash { _hash_key(value, table.seed) };
+			const auto idx { table.slot[_hash_slot<count()>(hash, table.disp[_hash_bucket<count()>(hash)])] };
+			return _enum_values[idx] == value ? idx : count();
+		}
+	}
+
+	/// perfect hash over a table of keys: names in value order (_enum_names, or unscoped_names in conjure_enum), or the
+	/// values themselves for sparse enums without a direct table. Keys are hashed into buckets of about two; buckets are
+	/// placed largest first, each trying displacements until all of its keys land in free slots. With a quarter of the
+	/// slots spare few displacements are tried, so the table is built in close to linear time. A lookup is one hash,
+	/// one displacement, one slot and one comparison
+	static constexpr std::uint64_t _hash_mul { 0x9e3779b97f4a7c15ULL };
+
+	template<std::size_t N>
+	struct _perfect_hash
+	{
+		static constexpr std::size_t buckets { N / 2 + 1 }, slots { N + N / 4 + 1 };
+		std::uint64_t seed;
+		fixed_array<std::uint32_t, buckets> disp;
+		fixed_array<std::uint32_t, slots> slot; // index into keys; free slots hold 0, which cannot compare equal
+		bool built, duplicate; // duplicate: two keys are equal, so no table can be built
+	};
+
+	/// values hash as their underlying integer, sign extended, through the splitmix64 finaliser
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _hash_key(T value, std::uint64_t seed) noexcept
+	{
+		std::uint64_t result { seed ^ static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(value)) };
+		result = (result ^ result >> 30) * 0xbf58476d1ce4e5b9ULL;
+		result = (result ^ result >> 27) * 0x94d049bb133111ebULL;
+		return result ^ result >> 31;
+	}
+
+	/// whole words are read as little endian (see _load_word) so the result does not depend on byte order
+	template<bool fold=false>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _hash_chars(const char *ptr, std::size_t len, std::uint64_t seed) noexcept
+	{
+		using U = unsigned char;
+		const char *const eptr { ptr + len };
+		std::uint64_t result { seed ^ len * _hash_mul };
+		for (; eptr - ptr >= 8; ptr += 8)
+		{
+			const std::uint64_t word { _load_word(ptr) };
+			result = (result ^ (fold ? _fold_word(word) : word)) * 0xbf58476d1ce4e5b9ULL;
+			result ^= result >> 31;
+		}
+		if (ptr < eptr)
+		{
+			std::uint64_t word{};
+			for (unsigned shift{}; ptr < eptr; ++ptr, shift += 8)
+				word |= std::uint64_t{U(*ptr)} << shift;
+			result = (result ^ (fold ? _fold_word(word) : word)) * 0xbf58476d1ce4e5b9ULL;
+			result ^= result >> 31;
+		}
+		return result;
+	}
+
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _hash_key(std::string_view str, std::uint64_t seed) noexcept
+	{
+		return _hash_chars(str.data(), str.size(), seed);
+	}
+
+	/// a name hashed and compared without regard to ASCII case
+	struct _nocase_name
+	{
+		std::string_view name;
+	};
+
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _hash_key(_nocase_name key, std::uint64_t seed) noexcept
+	{
+		return _hash_chars<true>(key.name.data(), key.name.size(), seed);
+	}
+
+	/// ASCII upper case letters in each byte of a word made lower case, other bytes unchanged
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _fold_word(std::uint64_t word) noexcept
+	{
+		constexpr std::uint64_t ones { 0x0101010101010101ULL }, high { ones * 0x80 };
+		const auto low7 { word & ~high };
+		const auto upper { (low7 + ones * (0x80 - 'A')) & ~(low7 + ones * (0x80 - 'Z' - 1)) & ~word & high };
+		return word | upper >> 2;
+	}
+
+	FIX8_CONJURE_ENUM_INLINE static constexpr bool _same_nocase(std::string_view pl, std::string_view pr) noexcept
+	{
+		if (pl.size() != pr.size())
+			return false;
+		const char *lp { pl.data() }, *rp { pr.data() };
+		const std::size_t len { pl.size() };
+		if (len < 8)
+		{
+			std::uint64_t lw{}, rw{};
+			for (std::size_t pos{}; pos < len; ++pos)
+			{
+				lw |= std::uint64_t{static_cast<unsigned char>(lp[pos])} << pos * 8;
+				rw |= std::uint64_t{static_cast<unsigned char>(rp[pos])} << pos * 8;
+			}
+			return _fold_word(lw) == _fold_word(rw);
+		}
+		for (std::size_t pos{}; pos + 8 < len; pos += 8)
+			if (_fold_word(_load_word(lp + pos)) != _fold_word(_load_word(rp + pos)))
+				return false;
+		return _fold_word(_load_word(lp + len - 8)) == _fold_word(_load_word(rp + len - 8));
+	}
+
+	/// equal keys cannot be separated by any seed, so the builder checks for them when a bucket cannot be placed
+	static constexpr bool _same_key(std::string_view pl, std::string_view pr) noexcept { return pl == pr; }
+	static constexpr bool _same_key(T pl, T pr) noexcept { return pl == pr; }
+	static constexpr bool _same_key(_nocase_name pl, _nocase_name pr) noexcept { return _same_nocase(pl.name, pr.name); }
+
+	template<std::size_t N>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _hash_bucket(std::uint64_t hash) noexcept
+	{
+		return static_cast<std::size_t>((hash & 0xffffffffULL) * _perfect_hash<N>::buckets >> 32);
+	}
+
+	template<std::size_t N>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _hash_slot(std::uint64_t hash, std::uint32_t disp) noexcept
+	{
+		return static_cast<std::size_t>((((hash ^ disp) * _hash_mul) >> 32) * _perfect_hash<N>::slots >> 32);
+	}
+
+	/// built in local arrays with the slot arithmetic written out, since element accessor and function calls are costly
+	/// in constant evaluation. Arrays are zeroed in order before any out of order writes; gcc stores an array written out
+	/// of order far less efficiently. Returns with built false if a bucket cannot be placed
+	template<const auto& keys>
+	static constexpr auto _build_hash(std::uint64_t seed) noexcept
+	{
+		using H = _perfect_hash<keys.size()>;
+		constexpr std::size_t sz { keys.size() }, nbuckets { H::buckets }, nslots { H::slots };
+		std::uint64_t hashes[sz];
+		std::size_t bucket[sz], members[sz], by_size[nbuckets], first[nbuckets + 1], fill[nbuckets], size_first[sz + 2];
+		std::uint32_t disps[nbuckets], slots[nslots];
+		bool used[nslots];
+		for (std::size_t idx{}; idx < sz + 2; ++idx)
+			size_first[idx] = 0;
+		for (std::size_t idx{}; idx <= nbuckets; ++idx)
+			first[idx] = 0;
+		for (std::size_t idx{}; idx < nbuckets; ++idx)
+			by_size[idx] = fill[idx] = disps[idx] = 0;
+		for (std::size_t idx{}; idx < nslots; ++idx)
+		{
+			slots[idx] = 0;
+			used[idx] = false;
+		}
+		for (std::size_t idx{}; idx < sz; ++idx)
+		{
+			hashes[idx] = _hash_key(keys[idx], seed);
+			bucket[idx] = static_cast<std::size_t>((hashes[idx] & 0xffffffffULL) * nbuckets >> 32);
+			members[idx] = 0;
+			++first[bucket[idx] + 1];
+		}
+		for (std::size_t bb{}; bb < nbuckets; ++bb) // counting sorts, keys by bucket then buckets by size
+			first[bb + 1] += first[bb];
+		for (std::size_t idx{}; idx < sz; ++idx)
+			members[first[bucket[idx]] + fill[bucket[idx]]++] = idx;
+		for (std::size_t bb{}; bb < nbuckets; ++bb)
+			++size_first[sz + 1 - (first[bb + 1] - first[bb])];
+		for (std::size_t ss{}; ss <= sz; ++ss)
+			size_first[ss + 1] += size_first[ss];
+		std::size_t used_buckets{};
+		for (std::size_t bb{}; bb < nbuckets; ++bb)
+			if (const auto bsz { first[bb + 1] - first[bb] }; bsz)
+			{
+				by_size[size_first[sz - bsz]++] = bb;
+				++used_buckets;
+			}
+		for (std::size_t nn{}; nn < used_buckets; ++nn)
+		{
+			const std::size_t bb { by_size[nn] }, kfirst { first[bb] }, klast { first[bb + 1] };
+			for (std::uint32_t disp{};; ++disp)
+			{
+				if (disp == 0xffff)
+				{
+					for (std::size_t kk { kfirst }; kk < klast; ++kk)
+						for (std::size_t jj { kk + 1 }; jj < klast; ++jj)
+							if (_same_key(keys[members[kk]], keys[members[jj]]))
+								return H { seed, {}, {}, false, true };
+					return H { seed, {}, {}, false, false }; // two keys in this bucket share a hash; try another seed
+				}
+				std::size_t kk { kfirst };
+				for (; kk < klast; ++kk)
+				{
+					const auto pos { static_cast<std::size_t>((((hashes[members[kk]] ^ disp) * _hash_mul) >> 32) * nslots >> 32) };
+					if (used[pos])
+						break;
+					used[pos] = true;
+				}
+				if (kk == klast)
+				{
+					disps[bb] = disp;
+					break;
+				}
+				while (kk-- > kfirst)
+					used[static_cast<std::size_t>((((hashes[members[kk]] ^ disp) * _hash_mul) >> 32) * nslots >> 32)] = false;
+			}
+			for (std::size_t kk { kfirst }; kk < klast; ++kk)
+				slots[static_cast<std::size_t>((((hashes[members[kk]] ^ disps[bb]) * _hash_mul) >> 32) * nslots >> 32)] = static_cast<std::uint32_t>(members[kk]);
+		}
+		H result { seed, {}, {}, true, false };
+		for (std::size_t bb{}; bb < nbuckets; ++bb)
+			result.disp[bb] = disps[bb];
+		for (std::size_t ss{}; ss < nslots; ++ss)
+			result.slot[ss] = slots[ss];
+		return result;
+	}
+
+	template<const auto& keys>
+	static constexpr auto _make_hash() noexcept
+	{
+		for (std::uint64_t seed{};; seed += _hash_mul)
+			if (const auto result { _build_hash<keys>(seed) }; result.built || result.duplicate)
+				return result;
+	}
+
+	template<const auto& keys>
+	static constexpr auto _hash_v { _make_hash<keys>() };
+
+	/// length of the prefix shared by every name in a table, such as "component::" or "ns::type::tag_", and where key words
+	/// start: after the common prefix, or earlier so that the shortest name still fills a whole word. Slots and keys hold
+	/// the bytes after these, and a lookup compares the common prefix once, only when the rest matches. Every name in
+	/// _enum_names starts with the scope, so its bytes are not compared again
+	struct _name_shape
+	{
+		std::size_t common, key_offset, longest;
+	};
+
+	template<const auto& names>
+	static constexpr _name_shape _make_name_shape() noexcept
+	{
+		if constexpr (names.size() == 0)
+			return {};
+		else
+		{
+			std::size_t known {};
+			if constexpr (static_cast<const void *>(&names) == static_cast<const void *>(&_enum_names))
+				known = _scope_size;
+			const char *first { names[0].data() };
+			std::size_t common { names[0].size() }, shortest { common };
+			for (std::size_t idx { 1 }; idx < names.size(); ++idx)
+			{
+				const auto name { names[idx] };
+				const char *ptr { name.data() };
+				std::size_t pos { known }, len { name.size() };
+				if (len < shortest)
+					shortest = len;
+				if (len < common)
+					common = len;
+				while (pos < common && ptr[pos] == first[pos])
+					++pos;
+				common = pos;
+			}
+			std::size_t longest {};
+			for (const auto name : names)
+				longest = name.size() > longest ? name.size() : longest;
+			return { common, shortest < 8 ? 0 : shortest - 8 < common ? shortest - 8 : common, longest };
+		}
+	}
+
+	template<const auto& names>
+	static constexpr auto _name_shape_v { _make_name_shape<names>() };
+
+	template<const auto& names>
+	FIX8_CONJURE_ENUM_INLINE static constexpr bool _same_common_prefix(const char *ptr) noexcept
+	{
+		constexpr std::size_t len { _name_shape_v<names>.common };
+		if constexpr (len == 0)
+			return true;
+		else
+			return _same_chars(ptr, _common_chars_v<names>.begin(), len);
+	}
+
+	/// small tables (up to 64 names of up to 32 characters after the common prefix) also keep a copy of each slot's name
+	/// after the common prefix, zero padded to a fixed width and stored with the full size and the index. A lookup then reads
+	/// a single slot, rejects on size and compares with a few whole word loads instead of following the string_view and
+	/// calling memcmp
+	static constexpr std::size_t _slot_max_names { 64 }, _slot_width { 32 };
+
+	struct _name_slot
+	{
+		char name[_slot_width];
+		std::uint32_t size, index;
+	};
+
+	template<const auto& names>
+	static constexpr bool _fits_slots() noexcept
+	{
+		if constexpr (names.size() > _slot_max_names)
+			return false;
+		else
+		{
+			for (std::size_t idx{}; idx < names.size(); ++idx)
+				if (names[idx].size() - _name_shape_v<names>.common > _slot_width)
+					return false;
+			return true;
+		}
+	}
+
+	template<const auto& names>
+	static constexpr name_lookup _name_strategy() noexcept
+	{
+		return _fits_slots<names>() ? name_lookup::slots : name_lookup::keys;
+	}
+
+	template<const auto& names>
+	static constexpr auto _make_slots() noexcept
+	{
+		constexpr const auto& table { _hash_v<names> };
+		fixed_array<_name_slot, _perfect_hash<names.size()>::slots> result{};
+		for (std::size_t ss{}; ss < result.size(); ++ss)
+		{
+			const auto idx { table.slot[ss] }; // free slots copy names[0], as the plain table compares against it
+			const auto name { names[idx] };
+			auto& slot { result[ss] };
+			for (std::size_t pos { _name_shape_v<names>.common }; pos < name.size(); ++pos)
+				slot.name[pos - _name_shape_v<names>.common] = name[pos];
+			slot.size = static_cast<std::uint32_t>(name.size());
+			slot.index = idx;
+		}
+		return result;
+	}
+
+	template<const auto& names>
+	static constexpr auto _slots_v { _make_slots<names>() };
+
+	/// little endian words assembled from bytes; optimizers turn each into one unaligned load. Where that is the native
+	/// order the run time load is written as one, as an unoptimized build would otherwise assemble it byte by byte
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _load_word(const char *ptr) noexcept
+	{
+#if defined FIX8_CONJURE_ENUM_NATIVE_LOADS
+		if (!__builtin_is_constant_evaluated())
+		{
+			std::uint64_t result;
+			__builtin_memcpy(&result, ptr, sizeof(result));
+			return result;
+		}
+#endif
+		using U = unsigned char;
+		return std::uint64_t{U(ptr[0])} | std::uint64_t{U(ptr[1])} << 8 | std::uint64_t{U(ptr[2])} << 16 | std::uint64_t{U(ptr[3])} << 24
+			| std::uint64_t{U(ptr[4])} << 32 | std::uint64_t{U(ptr[5])} << 40 | std::uint64_t{U(ptr[6])} << 48 | std::uint64_t{U(ptr[7])} << 56;
+	}
+
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint32_t _load_half(const char *ptr) noexcept
+	{
+#if defined FIX8_CONJURE_ENUM_NATIVE_LOADS
+		if (!__builtin_is_constant_evaluated())
+		{
+			std::uint32_t result;
+			__builtin_memcpy(&result, ptr, sizeof(result));
+			return result;
+		}
+#endif
+		using U = unsigned char;
+		return std::uint32_t{U(ptr[0])} | std::uint32_t{U(ptr[1])} << 8 | std::uint32_t{U(ptr[2])} << 16 | std::uint32_t{U(ptr[3])} << 24;
+	}
+
+	/// compares len (at most _slot_width) bytes; the first and last words overlap for lengths that are not a multiple
+	/// of the word size, so neither side is read beyond len
+	FIX8_CONJURE_ENUM_INLINE static constexpr bool _same_bytes(const char *pl, const char *pr, std::size_t len) noexcept
+	{
+		if (len >= 16)
+			return !((_load_word(pl) ^ _load_word(pr)) | (_load_word(pl + 8) ^ _load_word(pr + 8))
+				| (_load_word(pl + len - 16) ^ _load_word(pr + len - 16)) | (_load_word(pl + len - 8) ^ _load_word(pr + len - 8)));
+		if (len >= 8)
+			return !((_load_word(pl) ^ _load_word(pr)) | (_load_word(pl + len - 8) ^ _load_word(pr + len - 8)));
+		if (len >= 4)
+			return !((_load_half(pl) ^ _load_half(pr)) | (_load_half(pl + len - 4) ^ _load_half(pr + len - 4)));
+		return len == 0 || (pl[0] == pr[0] && pl[len / 2] == pr[len / 2] && pl[len - 1] == pr[len - 1]);
+	}
+
+	/// any number of bytes, a word at a time, in place of memcmp; the last word overlaps as in _same_bytes
+	FIX8_CONJURE_ENUM_INLINE static constexpr bool _same_chars(const char *pl, const char *pr, std::size_t len) noexcept
+	{
+		if (len <= _slot_width)
+			return _same_bytes(pl, pr, len);
+		for (std::size_t pos{}; pos + 8 < len; pos += 8)
+			if (_load_word(pl + pos) != _load_word(pr + pos))
+				return false;
+		return _load_word(pl + len - 8) == _load_word(pr + len - 8);
+	}
+
+	/// up to the first 8 bytes of len as a little endian word, zero filled; words and halves overlap as in _same_bytes
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::uint64_t _prefix_word(const char *ptr, std::size_t len) noexcept
+	{
+		if (len >= 8)
+			return _load_word(ptr);
+		if (len >= 4)
+			return _load_half(ptr) | std::uint64_t{_load_half(ptr + len - 4)} << (len - 4) * 8;
+		using U = unsigned char;
+		return len == 0 ? 0 : std::uint64_t{U(ptr[0])} | std::uint64_t{U(ptr[len / 2])} << len / 2 * 8 | std::uint64_t{U(ptr[len - 1])} << (len - 1) * 8;
+	}
+
+	/// tables that do not fit name slots keep a packed key for each slot instead: the first 8 bytes after the common prefix,
+	/// the name's size and its index, 16 bytes in all. A probe reads one key and rejects most misses without touching the
+	/// names; names of up to 8 bytes after the prefix are then matched, longer ones compare their remaining bytes
+	struct _name_key
+	{
+		std::uint64_t prefix;
+		std::uint32_t size, index;
+	};
+
+	template<const auto& names>
+	static constexpr auto _make_keys() noexcept
+	{
+		constexpr const auto& table { _hash_v<names> };
+		fixed_array<_name_key, _perfect_hash<names.size()>::slots> result{};
+		for (std::size_t ss{}; ss < result.size(); ++ss)
+		{
+			const auto idx { table.slot[ss] }; // free slots copy names[0], as the plain table compares against it
+			result[ss] = { _prefix_word(names[idx].data() + _name_shape_v<names>.key_offset, names[idx].size() - _name_shape_v<names>.key_offset),
+				static_cast<std::uint32_t>(names[idx].size()), idx };
+		}
+		return result;
+	}
+
+	template<const auto& names>
+	static constexpr auto _keys_v { _make_keys<names>() };
+
+	/// index in names, or names.size() if not found. The input is read through a pointer and a length taken once, and
+	/// every helper is forced inline, so an unoptimized build makes no calls here beyond those into std::string_view
+	template<const auto& names>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _find_name(std::string_view str) noexcept
+	{
+		constexpr std::size_t skip { _name_shape_v<names>.common }, none { names.size() };
+		const char *const ptr { str.data() };
+		const std::size_t len { str.size() };
+		constexpr const auto& table { _hash_v<names> };
+		const auto hash { _hash_chars(ptr, len, table.seed) };
+		const auto pos { _hash_slot<none>(hash, table.disp[_hash_bucket<none>(hash)]) };
+		if constexpr (_name_strategy<names>() == name_lookup::slots)
+		{
+			const auto& slot { _slots_v<names>[pos] };
+			return slot.size == len && _same_bytes(slot.name, ptr + skip, len - skip) && _same_common_prefix<names>(ptr) ? slot.index : none;
+		}
+		else
+		{
+			constexpr std::size_t koff { _name_shape_v<names>.key_offset };
+			const auto& key { _keys_v<names>[pos] };
+			if (key.size != len || key.prefix != _prefix_word(ptr + koff, len - koff))
+				return none;
+			return (len <= koff + 8 || _same_chars(names[key.index].data() + koff + 8, ptr + koff + 8, len - koff - 8))
+				&& _same_common_prefix<names>(ptr) ? key.index : none;
+		}
+	}
+
+	/// scoped names in value order followed by the same names without their scope, so that one hash resolves either
+	/// spelling; keyed on count() only so that it is built on first use
+	template<std::size_t N>
+	static constexpr auto _make_any_names() noexcept
+	{
+		fixed_array<std::string_view, N * 2> result{};
+		for (std::size_t idx{}; idx < N; ++idx)
+			result[idx] = _enum_names[idx];
+		for (std::size_t idx{}; idx < N; ++idx)
+			result[N + idx] = { _enum_names[idx].data() + _scope_size, _enum_names[idx].size() - _scope_size };
+		return result;
+	}
+
+	template<std::size_t N>
+	static constexpr auto _any_names_v { _make_any_names<N>() };
+
+	template<const auto& names>
+	static constexpr auto _make_nocase() noexcept
+	{
+		fixed_array<_nocase_name, names.size()> result{};
+		for (std::size_t idx{}; idx < names.size(); ++idx)
+			result[idx] = { names[idx] };
+		return result;
+	}
+
+	template<const auto& names>
+	static constexpr auto _nocase_v { _make_nocase<names>() };
+
+	/// index in names ignoring ASCII case, or names.size() if not found
+	template<const auto& names>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _find_name_nocase(std::string_view str) noexcept
+	{
+		constexpr const auto& table { _hash_v<_nocase_v<names>> };
+		static_assert(!table.duplicate, "conjure_enum: enum has names that differ only by case, so case insensitive lookup is ambiguous");
+		const auto hash { _hash_key(_nocase_name { str }, table.seed) };
+		const auto idx { table.slot[_hash_slot<names.size()>(hash, table.disp[_hash_bucket<names.size()>(hash)])] };
+		return _same_nocase(names[idx], str) ? idx : names.size();
+	}
+
+	/// index in _enum_names of a scoped or unscoped name, or count() if not found. Names without a scope are
+	/// looked up as they are
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _find_any_name(std::string_view str) noexcept
+	{
+		if constexpr (_scope_size == 0)
+			return _find_name<_enum_names>(str);
+		else
+		{
+			const auto idx { _find_name<_any_names_v<count()>>(str) };
+			return idx < count() ? idx : idx < 2 * count() ? idx - count() : count();
+		}
+	}
+
+	/// byte level DFA over a table of names, for longest prefix matching. Bytes map to classes, one for each distinct
+	/// byte used in the names and class 0 for all others, so a state is a row of classes rather than of 256 entries.
+	/// State 0 is the dead state and state 1 the root. A first pass builds a sibling list trie to size the tables;
+	/// the second fills the rows directly
+	template<std::size_t S, std::size_t C>
+	struct _name_trie
+	{
+		using state_type = std::conditional_t<(S <= 0xffff), std::uint16_t, std::uint32_t>;
+		static constexpr std::size_t states { S }, classes { C };
+		fixed_array<std::uint8_t, 256> cls;
+		fixed_array<state_type, S * C> next;
+		fixed_array<std::uint32_t, S> accept; // index into names plus one, 0 if no name ends in this state
+	};
+
+	struct _trie_shape
+	{
+		std::size_t states, classes;
+	};
+
+	struct _prefix_match
+	{
+		std::size_t index, consumed; // index is count() if nothing matched
+	};
+
+	template<const auto& names>
+	static constexpr std::size_t _name_chars() noexcept
+	{
+		std::size_t result{};
+		for (std::size_t idx{}; idx < names.size(); ++idx)
+			result += names[idx].size();
+		return result;
+	}
+
+	template<const auto& names>
+	static constexpr _trie_shape _trie_size() noexcept
+	{
+		using U = unsigned char;
+		constexpr std::size_t bound { _name_chars<names>() + 2 };
+		char chr[bound];
+		std::size_t child[bound], sibling[bound], states { 2 }, classes { 1 };
+		bool used[256];
+		for (std::size_t idx{}; idx < 256; ++idx)
+			used[idx] = false;
+		chr[0] = chr[1] = 0;
+		child[0] = child[1] = sibling[0] = sibling[1] = 0;
+		for (std::size_t idx{}; idx < names.size(); ++idx)
+		{
+			std::size_t st { 1 };
+			for (const char cc : names[idx])
+			{
+				classes += !used[U(cc)];
+				used[U(cc)] = true;
+				std::size_t kid { child[st] };
+				while (kid && chr[kid] != cc)
+					kid = sibling[kid];
+				if (!kid)
+				{
+					kid = states++;
+					chr[kid] = cc;
+					child[kid] = 0;
+					sibling[kid] = child[st];
+					child[st] = kid;
+				}
+				st = kid;
+			}
+		}
+		return { states, classes };
+	}
+
+	template<const auto& names>
+	static constexpr auto _make_trie() noexcept
+	{
+		using U = unsigned char;
+		constexpr auto shape { _trie_size<names>() };
+		using N = _name_trie<shape.states, shape.classes>;
+		N result{};
+		for (std::size_t idx{}; idx < names.size(); ++idx)
+			for (const char cc : names[idx])
+				result.cls[U(cc)] = 1;
+		for (std::size_t idx{}, cl{}; idx < 256; ++idx) // classes in byte order
+			if (result.cls[idx])
+				result.cls[idx] = static_cast<std::uint8_t>(++cl);
+		std::size_t states { 2 };
+		for (std::size_t idx{}; idx < names.size(); ++idx)
+		{
+			std::size_t st { 1 };
+			for (const char cc : names[idx])
+			{
+				auto& nxt { result.next[st * N::classes + result.cls[U(cc)]] };
+				if (!nxt)
+					nxt = static_cast<typename N::state_type>(states++);
+				st = nxt;
+			}
+			result.accept[st] = static_cast<std::uint32_t>(idx + 1);
+		}
+		return result;
+	}
+
+	template<const auto& names>
+	static constexpr auto _trie_v { _make_trie<names>() };
+
+	/// longest name in names that str starts with, in a single pass over str; one table read per byte
+	template<const auto& names>
+	FIX8_CONJURE_ENUM_INLINE static constexpr _prefix_match _match_prefix(std::string_view str) noexcept
+	{
+		constexpr const auto& trie { _trie_v<names> };
+		constexpr std::size_t classes { std::remove_cvref_t<decltype(trie)>::classes };
+		_prefix_match result { count(), 0 };
+		for (std::size_t pos{}, st { 1 }; pos < str.size();)
+		{
+			if (!(st = trie.next[st * classes + trie.cls[static_cast<unsigned char>(str[pos++])]]))
+				break;
+			if (const auto acc { trie.accept[st] }; acc)
+				result = { acc - 1, pos };
+		}
+		return result;
+	}
+
+	/// DFA state after the common prefix of names
+	template<const auto& names>
+	static constexpr std::size_t _trie_common_state() noexcept
+	{
+		constexpr const auto& trie { _trie_v<names> };
+		std::size_t st { 1 };
+		for (std::size_t pos{}; pos < _name_shape_v<names>.common; ++pos)
+			st = trie.next[st * trie.classes + trie.cls[static_cast<unsigned char>(names[0][pos])]];
+		return st;
+	}
+
+	template<const auto& names>
+	static constexpr std::size_t _trie_start_v { _trie_common_state<names>() };
+
+	/// the common prefix of names as an array of constants, which compilers compare against immediates
+	template<const auto& names>
+	static constexpr auto _make_common_chars() noexcept
+	{
+		fixed_array<char, _name_shape_v<names>.common + 1> result{};
+		for (std::size_t pos{}; pos < _name_shape_v<names>.common; ++pos)
+			result[pos] = names[0][pos];
+		return result;
+	}
+
+	template<const auto& names>
+	static constexpr auto _common_chars_v { _make_common_chars<names>() };
+
+	/// names up to this long are found in a NUL terminated string by walking the DFA; longer ones are measured and hashed
+	static constexpr std::size_t _cstr_walk_max { 12 };
+
+	/// index in names of a NUL terminated string, or names.size() if not found. The walk costs about a byte compare or a
+	/// table load per byte of the input, which only beats strlen and one hash probe for short names; so when every name
+	/// is short, the common prefix is compared first, in blocks of 8 bytes that compilers unroll; the terminator differs
+	/// from every byte of it, so the comparison stops there for a shorter string, and no byte past it is read. The rest
+	/// walks the match_prefix DFA, reading each byte once and ending at the terminator or at the first byte no name
+	/// continues with, and the length is never measured. Otherwise the string is measured and looked up as a std::string_view
+	template<const auto& names>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _find_cstr(const char *str) noexcept
+	{
+		if (!str)
+			return names.size();
+		if constexpr (_name_shape_v<names>.longest > _cstr_walk_max)
+			return _find_name<names>(std::string_view(str));
+		else
+		{
+			constexpr const auto& trie { _trie_v<names> };
+			constexpr std::size_t classes { std::remove_cvref_t<decltype(trie)>::classes }, skip { _name_shape_v<names>.common };
+			std::size_t pos{};
+			for (; pos + 8 <= skip; pos += 8)
+				for (std::size_t off{}; off < 8; ++off)
+					if (str[pos + off] != _common_chars_v<names>[pos + off])
+						return names.size();
+			for (; pos < skip; ++pos)
+				if (str[pos] != _common_chars_v<names>[pos])
+					return names.size();
+			str += skip;
+			std::size_t st { _trie_start_v<names> };
+			for (; *str; ++str)
+				if (!(st = trie.next[st * classes + trie.cls[static_cast<unsigned char>(*str)]]))
+					return names.size();
+			return trie.accept[st] ? trie.accept[st] - 1 : names.size();
+		}
+	}
+
+	/// composite flags; each '|' separated name is looked up by name
+	static constexpr core_optional<T> _string_to_flags(std::string_view str) noexcept
+	{
+		_flag_type result{};
+		for (std::size_t pos{}; pos <= str.size();)
+		{
+			const auto sep { _min(str.find('|', pos), str.size()) };
+			const auto idx { _find_name<_enum_names>(str.substr(pos, sep - pos)) };
+			if (idx == count())
+				return {};
+			result |= static_cast<_flag_type>(_enum_values[idx]);
+			pos = sep + 1;
+		}
+		return static_cast<T>(result);
+	}
+
+public:
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t count() noexcept { return _enum_values.size(); }
+	static constexpr bool is_continuous() noexcept { return (static_cast<size_t>(max_v) - static_cast<size_t>(min_v) + 1) == count(); }
+	FIX8_CONJURE_ENUM_INLINE static constexpr bool in_range(T value) noexcept { return !(value < min_v) && !(max_v < value); }
+
+	/// the value and name lookups chosen for T, with the bytes of their tables and the reads of a hit (see lookup_strategy)
+	static constexpr lookup_strategy strategy() noexcept
+	{
+		using H = _perfect_hash<count()>;
+		constexpr auto values { _value_strategy() };
+		constexpr auto names { _name_strategy<_enum_names>() };
+		lookup_strategy result { values, names, 0, sizeof(H), 0, 2 }; // names: displacement and slot or key
+		if constexpr (values == value_lookup::direct)
+		{
+			result.value_bytes = sizeof(_direct_table_t<count(), _value_offset(_enum_values[count() - 1]) + 1>);
+			result.value_probes = 1; // index
+		}
+		else if constexpr (values == value_lookup::hash)
+		{
+			result.value_bytes = sizeof(H);
+			result.value_probes = 3; // displacement, slot and value
+		}
+		if constexpr (names == name_lookup::slots)
+			result.name_bytes += sizeof(fixed_array<_name_slot, H::slots>);
+		else
+		{
+			result.name_bytes += sizeof(fixed_array<_name_key, H::slots>);
+			for (const auto name : _enum_names)
+				if (name.size() > _name_shape_v<_enum_names>.key_offset + 8)
+				{
+					++result.name_probes; // the rest of the name
+					break;
+				}
+		}
+		if constexpr (_name_shape_v<_enum_names>.common > 0)
+			++result.name_probes; // common prefix
+		return result;
+	}
+
+	// index
+	FIX8_CONJURE_ENUM_INLINE static constexpr core_optional<std::size_t> index(T value) noexcept
+	{
+		if (const auto idx { _find_value(value) }; idx != count())
+			return idx;
+		return {};
+	}
+	template<T e>
+	static constexpr core_optional<std::size_t> index() noexcept { return index(e); }
+
+	// contains
+	template<T e>
+	static constexpr bool is_valid() noexcept { return contains<e>(); }
+
+	FIX8_CONJURE_ENUM_INLINE static constexpr bool contains(T value) noexcept
+	{
+		if constexpr (_value_strategy() == value_lookup::continuous)
+			return in_range(value);
+		else if constexpr (_value_strategy() == value_lookup::direct)
+		{
+			constexpr const auto& table { _direct() };
+			const auto off { _value_offset(value) };
+			return off < table.index.size() && (table.present[off / 64] >> off % 64 & 1);
+		}
+		else
+			return _find_value(value) != count();
+	}
+	FIX8_CONJURE_ENUM_INLINE static constexpr bool contains(std::string_view str) noexcept
+	{
+		return _find_name<_enum_names>(str) != count();
+	}
+	template<T e>
+	static constexpr bool contains() noexcept { return contains(e); }
+
+	// string <==> enum
+	template<T e>
+	static constexpr std::string_view enum_to_string() noexcept { return _get_name_v<e>; }
+
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::string_view enum_to_string(T value, bool noscope=false) noexcept
+	{
+		if (const auto idx { _find_value(value) }; idx != count())
+		{
+			const auto name { _enum_names[idx] };
+			const std::size_t from { noscope ? _noscope_size : 0 };
+			return { name.data() + from, name.size() - from };
+		}
+		return {};
+	}
+	FIX8_CONJURE_ENUM_INLINE static constexpr core_optional<T> string_to_enum(std::string_view str) noexcept
+	{
+		if (const auto idx { _find_name<_enum_names>(str) }; idx != count())
+			return _enum_values[idx];
+		if constexpr (_flags)
+			return _string_to_flags(str);
+		else
+			return {};
+	}
+	/// NUL terminated; measured only when a name is longer than _cstr_walk_max (12) characters, otherwise walked without strlen
+	template<c_string C>
+	FIX8_CONJURE_ENUM_INLINE static constexpr core_optional<T> string_to_enum(const C& str) noexcept
+	{
+		if (const auto idx { _find_cstr<_enum_names>(str) }; idx != count())
+			return _enum_values[idx];
+		if constexpr (_flags)
+			return str ? _string_to_flags(str) : core_optional<T>{};
+		else
+			return {};
+	}
+	FIX8_CONJURE_ENUM_INLINE static constexpr core_optional<T> nocase_string_to_enum(std::string_view str) noexcept
+	{
+		if (const auto idx { _find_name_nocase<_enum_names>(str) }; idx != count())
+			return _enum_values[idx];
+		return {};
+	}
+	FIX8_CONJURE_ENUM_INLINE static constexpr core_optional<T> any_string_to_enum(std::string_view str) noexcept
+	{
+		if (const auto idx { _find_any_name(str) }; idx != count())
+			return _enum_values[idx];
+		return {};
+	}
+
+protected:
+	// core tables; values in value order, names in the same order and name/value pairs in name order
+	static constexpr auto _enum_values { _values() };
+	static constexpr auto _enum_names { _names() };
+	static constexpr auto _by_name { _sorted_names() };
+	static constexpr std::size_t _scope_size { _get_scope_size() };
+	/// where enum_to_string(value, true) starts a name; remove_scope leaves the names of an unscoped enum as they are,
+	/// namespaces and all, so noscope does too
+	static constexpr std::size_t _noscope_size { std::is_convertible_v<T, std::underlying_type_t<T>> ? 0 : _scope_size };
+
+public:
+	// misc
+	static constexpr int get_enum_min_value() noexcept { return enum_min_value; }
+	static constexpr int get_enum_max_value() noexcept { return enum_max_value; }
+	static constexpr T min_v { _enum_values[0] };
+	static constexpr T max_v { _enum_values[_enum_values.size() - 1] };
+	static constexpr int get_actual_enum_min_value() noexcept { return static_cast<int>(min_v); }
+	static constexpr int get_actual_enum_max_value() noexcept { return static_cast<int>(max_v); }
+};
+
+//-----------------------------------------------------------------------------------------
+} // FIX8
+
+#endif // FIX8_CONJURE_ENUM_CORE_HPP_
@@ -38,15 +38,20 @@
 
 //----------------------------------------------------------------------------------------
 private:
+	/// without enum_traits<T>::extended the extended tables are left empty
+	static constexpr std::size_t _ext_count { _extended ? count() : 0 };
+
 	static constexpr bool _scoped_comp(const scoped_tuple& pl, const scoped_tuple& pr) noexcept
 	{
 		return std::get<0>(pl) < std::get<0>(pr);
 	}
 
-	template<std::size_t... I>
-	static constexpr auto _names(std::index_sequence<I...>) noexcept
+	static constexpr auto _names() noexcept
 	{
-		return std::array<std::string_view, sizeof...(I)>{{{ _enum_name_v<values[I]>}...}};
+		std::array<std::string_view, _ext_count> result{};
+		for (std::size_t idx{}; idx < result.size(); ++idx)
+			result[idx] = std::get<std::string_view>(entries[idx]);
+		return result;
 	}
 
 	static constexpr std::string_view _remove_scope(std::string_view what) noexcept
@@ -56,10 +61,53 @@ private:
 		return what;
 	}
 
+	/// large enums reuse the name order of the core tables; every name has the same scope, so removing it does not change the order
+	static constexpr auto _unscoped_entries() noexcept
+	{
+		if constexpr (_large)
+		{
+			constexpr const auto& order { _name_order() };
+			std::array<enum_tuple, _ext_count> tmp{};
+			for (std::size_t idx{}; idx < tmp.size(); ++idx)
+				tmp[idx] = { values[order[idx]], unscoped_names[order[idx]] };
+			return tmp;
+		}
+		else
+			return _unscoped_entries(std::make_index_sequence<_ext_count>());
+	}
+
+	static constexpr auto _scoped_entries() noexcept
+	{
+		if constexpr (_large)
+		{
+			constexpr const auto& order { _name_order() };
+			std::array<scoped_tuple, _ext_count> tmp{};
+			for (std::size_t idx{}; idx < tmp.size(); ++idx)
+				tmp[idx] = { unscoped_names[order[idx]], std::get<std::string_view>(entries[order[idx]]) };
+			return tmp;
+		}
+		else
+			return _scoped_entries(std::make_index_sequence<_ext_count>());
+	}
+
+	static constexpr auto _rev_scoped_entries() noexcept
+	{
+		if constexpr (_large)
+		{
+			constexpr const auto& order { _name_order() };
+			std::array<scoped_tuple, _ext_count> tmp{};
+			for (std::size_t idx{}; idx < tmp.size(); ++idx)
+				tmp[idx] = { std::get<std::string_view>(entries[order[idx]]), unscoped_names[order[idx]] };
+			return tmp;
+		}
+		else
+			return _rev_scoped_entries(std::make_index_sequence<_ext_count>());
+	}
+
 	template<std::size_t... I>
 	static constexpr auto _unscoped_entries(std::index_sequence<I...>) noexcept
 	{
-		std::array<enum_tuple, sizeof...(I)> tmp{{{ values[I], _remove_scope(_enum_name_v<values[I]>)}...}};
+		std::array<enum_tuple, sizeof...(I)> tmp{{{ values[I], _remove_scope(std::get<std::string_view>(entries[I]))}...}};
 		std::sort(tmp.begin(), tmp.end(), _tuple_comp_rev);
 		return tmp;
 	}
@@ -67,7 +115,7 @@ private:
 	template<std::size_t... I>
 	static constexpr auto _scoped_entries(std::index_sequence<I...>) noexcept
 	{
-		std::array<scoped_tuple, sizeof...(I)> tmp{{{ _remove_scope(_enum_name_v<values[I]>), _enum_name_v<values[I]>}...}};
+		std::array<scoped_tuple, sizeof...(I)> tmp{{{ _remove_scope(std::get<std::string_view>(entries[I])), std::get<std::string_view>(entries[I])}...}};
 		std::sort(tmp.begin(), tmp.end(), _scoped_comp);
 		return tmp;
 	}
@@ -75,35 +123,45 @@ private:
 	template<std::size_t... I>
 	static constexpr auto _rev_scoped_entries(std::index_sequence<I...>) noexcept
 	{
-		std::array<scoped_tuple, sizeof...(I)> tmp{{{ _enum_name_v<values[I]>, _remove_scope(_enum_name_v<values[I]>)}...}};
+		std::array<scoped_tuple, sizeof...(I)> tmp{{{ std::get<std::string_view>(entries[I]), _remove_scope(std::get<std::string_view>(entries[I]))}...}};
 		std::sort(tmp.begin(), tmp.end(), _scoped_comp);
 		return tmp;
 	}
 
-	template<std::size_t... I>
-	static constexpr auto _unscoped_names(std::index_sequence<I...>) noexcept
+	static constexpr auto _unscoped_names() noexcept
 	{
-		return std::array<std::string_view, sizeof...(I)>{{{ _remove_scope(_enum_name_v<values[I]>)}...}};
+		std::array<std::string_view, _ext_count> result{};
+		for (std::size_t idx{}; idx < result.size(); ++idx)
+			result[idx] = _remove_scope(std::get<std::string_view>(entries[idx]));
+		return result;
 	}
 
-	static constexpr std::string_view _process_scope([[maybe_unused]] const auto& entr, std::string_view what) noexcept
+	/// entries index of each single bit flag value, -1 if none
+	static constexpr auto _flag_indices() noexcept
 	{
-		if constexpr (is_scoped())
-			if (const auto [begin,end] { std::equal_range(entr.cbegin(), entr.cend(), scoped_tuple(what, std::string_view()), _scoped_comp) };
-				begin != end)
-					return std::get<1>(*begin);
-		return what;
+		std::array<int, sizeof(T) * 8> result{};
+		result.fill(-1);
+		for (std::size_t idx{}; idx < _ext_count; ++idx)
+			if (const auto uval { static_cast<_flag_type>(std::get<T>(entries[idx])) }; std::has_single_bit(uval))
+				result[std::countr_zero(uval)] = static_cast<int>(idx);
+		return result;
 	}
 
 public:
-	static constexpr std::string_view remove_scope(std::string_view what) noexcept
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::string_view remove_scope(std::string_view what) noexcept requires (_extended)
 	{
-		return _process_scope(rev_scoped_entries, what);
+		if constexpr (is_scoped())
+			if (const auto idx { _core::template _find_name<_core::_enum_names>(what) }; idx != count())
+				return { _core::_enum_names[idx].data() + _scope_size, _core::_enum_names[idx].size() - _scope_size };
+		return what;
 	}
 
-	static constexpr std::string_view add_scope(std::string_view what) noexcept
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::string_view add_scope(std::string_view what) noexcept requires (_extended)
 	{
-		return _process_scope(scoped_entries, what);
+		if constexpr (is_scoped())
+			if (const auto idx { _core::template _find_name<unscoped_names>(what) }; idx != count())
+				return _core::_enum_names[idx];
+		return what;
 	}
 
 	// iterators
@@ -113,10 +171,61 @@ public:
 	static constexpr auto crend() noexcept { return entries.crend(); }
 	static constexpr auto front() noexcept { return *cbegin(); }
 	static constexpr auto back() noexcept { return *std::prev(cend()); }
-	static constexpr std::optional<T> unscoped_string_to_enum(std::string_view str) noexcept
+	/// flags enums only; composite values are decomposed bit by bit into "name|name..."
+	static constexpr std::string flags_to_string(T value, bool noscope=false) noexcept requires (_flags && _extended)
+	{
+		if (const auto name { enum_to_string(value, noscope) }; !name.empty())
+			return std::string(name);
+		std::string result;
+		for (auto uval { static_cast<_flag_type>(value) }; uval; uval &= uval - 1)
+		{
+			const auto idx { _flag_index[std::countr_zero(uval)] };
+			if (idx < 0) // bit without a name
+				return {};
+			if (!result.empty())
+				result += '|';
+			result += _core::_enum_names[idx].substr(noscope ? _core::_noscope_size : 0);
+		}
+		return result;
+	}
+
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::optional<T> unscoped_string_to_enum(std::string_view str) noexcept requires (_extended)
+	{
+		if (const auto idx { _core::template _find_name<unscoped_names>(str) }; idx != count())
+		{
+#if defined FIX8_CONJURE_ENUM_PROFILE
+			if (!std::is_constant_evaluated())
+				_profile_hit(profile_op::string_to_enum, values[idx]);
+#endif
+			return values[idx];
+		}
+		return {};
+	}
+	/// NUL terminated; measured only when an unscoped name is longer than 12 characters, otherwise walked without strlen
+	template<c_string C>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::optional<T> unscoped_string_to_enum(const C& str) noexcept requires (_extended)
+	{
+		if (const auto idx { _core::template _find_cstr<unscoped_names>(str) }; idx != count())
+		{
+#if defined FIX8_CONJURE_ENUM_PROFILE
+			if (!std::is_constant_evaluated())
+				_profile_hit(profile_op::string_to_enum, values[idx]);
+#endif
+			return values[idx];
+		}
+		return {};
+	}
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::optional<T> unscoped_nocase_string_to_enum(std::string_view str) noexcept requires (_extended)
+	{
+		if (const auto idx { _core::template _find_name_nocase<unscoped_names>(str) }; idx != count())
+			return values[idx];
+		return {};
+	}
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::optional<std::tuple<T, std::size_t>> unscoped_match_prefix(std::string_view str) noexcept requires (_extended)
 	{
-		const auto [begin,end] { std::equal_range(unscoped_entries.cbegin(), unscoped_entries.cend(), enum_tuple(T{}, str), _tuple_comp_rev) };
-		return begin != end ? std::get<T>(*begin) : std::optional<T>{};
+		if (const auto [idx, consumed] { _core::template _match_prefix<unscoped_names>(str) }; idx != count())
+			return std::tuple { values[idx], consumed };
+		return {};
 	}
 
 	static constexpr std::string_view type_name() noexcept
@@ -188,63 +297,162 @@ public:
 		return std::get<T>(pl) < std::get<T>(pr);
 	}
 
+private:
+	/// position of ev in the first n entries of a sorted dispatch table, or n if absent. A branchless lower bound written
+	/// out, so an unoptimized build does not go through std::equal_range, a comparator and a probe tuple
+	template<std::size_t I, typename Fn>
+	FIX8_CONJURE_ENUM_INLINE static constexpr std::size_t _dispatch_find(T ev, const std::array<std::tuple<T, Fn>, I>& disp, std::size_t n) noexcept
+	{
+		if (n == 0)
+			return n;
+		const std::tuple<T, Fn> *const table { disp.data() };
+		std::size_t lo{};
+		for (std::size_t len { n }; len > 1;)
+		{
+			const std::size_t half { len / 2 };
+			lo = std::get<T>(table[lo + half]) < ev ? lo + half : lo;
+			len -= half;
+		}
+		lo += std::get<T>(table[lo]) < ev;
+		return lo < n && std::get<T>(table[lo]) == ev ? lo : n;
+	}
+
+public:
+
 	template<std::size_t I, typename R, typename Fn, typename... Args> // with not found value(nval) for return
 	requires std::invocable<Fn&&, T, Args...>
 	[[maybe_unused]] static constexpr R dispatch(T ev, R nval, const std::array<std::tuple<T, Fn>, I>& disp, Args&&... args) noexcept
 	{
-		const auto [begin,end] { std::equal_range(disp.cbegin(), disp.cend(), std::make_tuple(ev, Fn()), tuple_comp<Fn>) };
-		return begin != end ? std::invoke(std::get<Fn>(*begin), ev, std::forward<Args>(args)...) : nval;
+		const auto pos { _dispatch_find(ev, disp, I) };
+#if defined FIX8_CONJURE_ENUM_PROFILE
+		if (!std::is_constant_evaluated() && pos != I)
+			_profile_hit(profile_op::dispatch, ev);
+#endif
+		return pos != I ? std::invoke(std::get<Fn>(disp[pos]), ev, std::forward<Args>(args)...) : nval;
 	}
 
 	template<std::size_t I, typename R, typename Fn, typename C, typename... Args> // specialisation for member function with not found value(nval) for return
 	requires std::invocable<Fn&&, C, T, Args...>
 	[[maybe_unused]] static constexpr R dispatch(T ev, R nval, const std::array<std::tuple<T, Fn>, I>& disp, C *obj, Args&&... args) noexcept
 	{
-		const auto [begin,end] { std::equal_range(disp.cbegin(), disp.cend(), std::make_tuple(ev, Fn()), tuple_comp<Fn>) };
-		return begin != end ? std::invoke(std::get<Fn>(*begin), obj, ev, std::forward<Args>(args)...) : nval;
+		const auto pos { _dispatch_find(ev, disp, I) };
+#if defined FIX8_CONJURE_ENUM_PROFILE
+		if (!std::is_constant_evaluated() && pos != I)
+			_profile_hit(profile_op::dispatch, ev);
+#endif
+		return pos != I ? std::invoke(std::get<Fn>(disp[pos]), obj, ev, std::forward<Args>(args)...) : nval;
 	}
 
 	template<std::size_t I, typename Fn, typename... Args> // void func with not found call to last element
 	requires (std::invocable<Fn&&, T, Args...> && I > 0)
 	static constexpr void dispatch(T ev, const std::array<std::tuple<T, Fn>, I>& disp, Args&&... args) noexcept
 	{
-		const auto [begin,end] { std::equal_range(disp.cbegin(), std::prev(disp.cend()), std::make_tuple(ev, Fn()), tuple_comp<Fn>) };
-		return std::invoke(std::get<Fn>(begin != end ? *begin : *std::prev(disp.cend())), ev, std::forward<Args>(args)...);
+		const auto pos { _dispatch_find(ev, disp, I - 1) }; // the last element is the not found call
+#if defined FIX8_CONJURE_ENUM_PROFILE
+		if (!std::is_constant_evaluated() && pos != I - 1)
+			_profile_hit(profile_op::dispatch, ev);
+#endif
+		return std::invoke(std::get<Fn>(disp[pos]), ev, std::forward<Args>(args)...);
 	}
 
 	template<std::size_t I, typename Fn, typename C, typename... Args> // specialisation for void member function with not found call to last element
 	requires (std::invocable<Fn&&, C, T, Args...> && I > 0)
 	static constexpr void dispatch(T ev, const std::array<std::tuple<T, Fn>, I>& disp, C *obj, Args&&... args) noexcept
 	{
-		const auto [begin,end] { std::equal_range(disp.cbegin(), std::prev(disp.cend()), std::make_tuple(ev, Fn()), tuple_comp<Fn>) };
-		return std::invoke(std::get<Fn>(begin != end ? *begin : *std::prev(disp.cend())), obj, ev, std::forward<Args>(args)...);
+		const auto pos { _dispatch_find(ev, disp, I - 1) }; // the last element is the not found call
+#if defined FIX8_CONJURE_ENUM_PROFILE
+		if (!std::is_constant_evaluated() && pos != I - 1)
+			_profile_hit(profile_op::dispatch, ev);
+#endif
+		return std::invoke(std::get<Fn>(disp[pos]), obj, ev, std::forward<Args>(args)...);
+	}
+
+#if defined FIX8_CONJURE_ENUM_PROFILE
+	// profiling; run time hits per enumerator in string_to_enum (and unscoped_string_to_enum), enum_to_string and dispatch
+	enum class profile_op { string_to_enum, enum_to_string, dispatch };
+
+	static std::tuple<std::uint64_t, std::uint64_t, std::uint64_t> profile_hits(T value) noexcept
+	{
+		if (const auto idx { _core::index(value) }; idx)
+		{
+			const auto& hits { _profile_hits[*idx] };
+			return { hits[0].load(std::memory_order_relaxed), hits[1].load(std::memory_order_relaxed), hits[2].load(std::memory_order_relaxed) };
+		}
+		return {};
+	}
+
+	static void profile_reset() noexcept
+	{
+		for (auto& hits : _profile_hits)
+			for (auto& hit : hits)
+				hit.store(0, std::memory_order_relaxed);
+	}
+
+	/// write the hits as comments, most frequent first; spelling is how T is named in the heading
+	static std::ostream& profile_write(std::ostream& os, std::string_view spelling=type_name())
+	{
+		std::array<std::tuple<std::uint64_t, std::size_t>, count()> order{};
+		for (std::size_t idx{}; idx < count(); ++idx)
+		{
+			const auto [ste, ets, dsp] { profile_hits(values[idx]) };
+			order[idx] = { ste + ets + dsp, idx };
+		}
+		std::stable_sort(order.begin(), order.end(), [](const auto& pl, const auto& pr) { return std::get<0>(pl) > std::get<0>(pr); });
+		os << "// conjure_enum profile: " << spelling << "; hits by string_to_enum, enum_to_string, dispatch\n";
+		for (const auto& [total, idx] : order)
+		{
+			if (!total)
+				break;
+			const auto [ste, ets, dsp] { profile_hits(values[idx]) };
+			os << "//   " << _core::_enum_names[idx] << ' ' << ste << ' ' << ets << ' ' << dsp << '\n';
+		}
+		return os;
+	}
+
+	/// append the profile to filename; false if it could not be written
+	static bool profile_write(const char *filename, std::string_view spelling=type_name())
+	{
+		std::ofstream ofs(filename, std::ios::app);
+		return ofs && profile_write(ofs, spelling);
+	}
+
+private:
+	static inline std::array<std::array<std::atomic<std::uint64_t>, 3>, count()> _profile_hits{};
+
+	static void _profile_hit(profile_op op, T value) noexcept
+	{
+		if (const auto idx { _core::index(value) }; idx)
+			_profile_hits[*idx][static_cast<std::size_t>(op)].fetch_add(1, std::memory_order_relaxed);
 	}
 
+public:
+#endif
+
 	// public constexpr data structures
-	static constexpr auto names { _names(std::make_index_sequence<count()>()) };
-	static constexpr auto scoped_entries { _scoped_entries(std::make_index_sequence<count()>()) };
-	static constexpr auto unscoped_entries { _unscoped_entries(std::make_index_sequence<count()>()) };
-	static constexpr auto rev_scoped_entries { _rev_scoped_entries(std::make_index_sequence<count()>()) };
-	static constexpr auto unscoped_names { _unscoped_names(std::make_index_sequence<count()>()) };
+	static constexpr auto names { _names() };
+	static constexpr auto unscoped_names { _unscoped_names() };
+	static constexpr auto scoped_entries { _scoped_entries() };
+	static constexpr auto unscoped_entries { _unscoped_entries() };
+	static constexpr auto rev_scoped_entries { _rev_scoped_entries() };
+
+private:
+	static constexpr auto _flag_index { _flag_indices() };
 };
 
 //-----------------------------------------------------------------------------------------
 // allow range based for
-template<valid_enum T>
+FIX8_CONJURE_ENUM_EXPORT template<valid_enum T>
 struct iterator_adaptor
 {
 	constexpr auto begin() noexcept { return conjure_enum<T>::entries.cbegin(); }
 	constexpr auto end() noexcept { return conjure_enum<T>::entries.cend(); }
 };
 
-//-----------------------------------------------------------------------------------------
-#include <ostream>
-
 //-----------------------------------------------------------------------------------------
 // ostream& operator<< for any enum; add the following before using:
 // using ostream_enum_operator::operator<<;
 //-----------------------------------------------------------------------------------------
-namespace ostream_enum_operator
+FIX8_CONJURE_ENUM_EXPORT namespace ostream_enum_operator
 {
 	template<typename CharT, typename Traits=std::char_traits<CharT>, valid_enum T>
 	constexpr std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, T value) noexcept
@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------------------
+// conjure_enum_gen
+// Writes a header that specialises enum_cache<T> with the reflected values and names of
+// each enum, so that translation units including it do not probe the enum themselves.
+// Normally used through the cmake function conjure_enum_generate; the generated driver is:
+//
+//    #include <fix8/conjure_enum_gen.hpp>
+//    #include "myenums.hpp"
+//    int main(int argc, char **argv)
+//    {
+//       return FIX8::conjure_enum_gen::run(argc, argv, { "myenums.hpp" },
+//          [](std::ostream& os) { FIX8::conjure_enum_gen::generate<my_enum>(os, "my_enum"); });
+//    }
+//
+// Include the generated header after the enum declarations in every translation unit that reflects
+// those enums (for example from a wrapper header); do not include it from the header the generator
+// itself includes. Its contents are skipped while FIX8_CONJURE_ENUM_GEN is defined.
+//----------------------------------------------------------------------------------------
+#ifndef FIX8_CONJURE_ENUM_GEN_HPP_
+#define FIX8_CONJURE_ENUM_GEN_HPP_
+
+#if not defined FIX8_CONJURE_ENUM_GEN
+# define FIX8_CONJURE_ENUM_GEN
+#endif
+
+//----------------------------------------------------------------------------------------
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <fix8/conjure_enum.hpp>
+
+//-----------------------------------------------------------------------------------------
+namespace FIX8 {
+
+//-----------------------------------------------------------------------------------------
+class conjure_enum_gen final : public static_only
+{
+	static std::ostream& _quoted(std::ostream& os, std::string_view what)
+	{
+		os << '"';
+		for (const auto cc : what)
+		{
+			if (cc == '"' || cc == '\\')
+				os << '\\';
+			os << cc;
+		}
+		return os << '"';
+	}
+
+	template<valid_enum T>
+	static std::ostream& _value(std::ostream& os, T value)
+	{
+		using U = std::underlying_type_t<T>;
+		if constexpr (std::is_signed_v<U>)
+		{
+			if (const auto val { static_cast<long long>(value) }; val == std::numeric_limits<long long>::min())
+				return os << "(-" << std::numeric_limits<long long>::max() << "LL - 1)";
+			else
+				return os << val << "LL";
+		}
+		else
+			return os << static_cast<unsigned long long>(value) << "ULL";
+	}
+
+public:
+	/// write the enum_cache<T> specialisation for T; spelling is how T is named in the generated header
+	template<valid_enum T>
+	static std::ostream& generate(std::ostream& os, std::string_view spelling)
+	{
+		os << "\n//-----------------------------------------------------------------------------------------\n"
+			"template<>\nstruct FIX8::enum_cache<" << spelling << ">\n{\n\tstatic constexpr std::array<" << spelling << ", "
+			<< conjure_enum<T>::count() << "> values\n\t{\n";
+		for (const auto& [value, name] : conjure_enum<T>::entries)
+			_value(os << "\t\tstatic_cast<" << spelling << ">(", value) << "),\n";
+		os << "\t};\n\tstatic constexpr std::array<std::string_view, " << conjure_enum<T>::count() << "> names\n\t{\n";
+		for (const auto& [value, name] : conjure_enum<T>::entries)
+			_quoted(os << "\t\t", name) << ",\n";
+		os << "\t};\n\tstatic constexpr std::array<std::size_t, " << conjure_enum<T>::count() << "> sorted\n\t{\n\t\t";
+		for (const auto& [value, name] : conjure_enum<T>::sorted_entries)
+			os << *conjure_enum<T>::index(value) << ", ";
+		return os << "\n\t};\n};\n";
+	}
+
+	/// write the header to argv[1]; gen writes each enum_cache<T> specialisation
+	template<typename Fn>
+	requires std::invocable<Fn&&, std::ostream&>
+	static int run(int argc, char **argv, std::initializer_list<std::string_view> includes, Fn&& gen)
+	{
+		if (argc < 2)
+		{
+			std::cerr << "usage: " << argv[0] << " <output header>\n";
+			return 1;
+		}
+		std::string guard { std::filesystem::path(argv[1]).filename().string() };
+		for (auto& cc : guard)
+			cc = std::isalnum(static_cast<unsigned char>(cc)) ? std::toupper(static_cast<unsigned char>(cc)) : '_';
+		std::ofstream ofs(argv[1]);
+		if (!ofs)
+		{
+			std::cerr << argv[0] << ": could not open " << argv[1] << '\n';
+			return 1;
+		}
+		ofs << "//-----------------------------------------------------------------------------------------\n"
+			"// conjure_enum reflection cache; generated by " << std::filesystem::path(argv[0]).filename().string() << ", do not edit\n"
+			"//-----------------------------------------------------------------------------------------\n"
+			"#ifndef FIX8_CONJURE_ENUM_CACHE_" << guard << "_\n#define FIX8_CONJURE_ENUM_CACHE_" << guard << "_\n"
+			"#if not defined FIX8_CONJURE_ENUM_GEN\n\n#include <fix8/conjure_enum.hpp>\n";
+		for (const auto include : includes)
+			_quoted(ofs << "#include ", include) << '\n';
+		std::invoke(std::forward<Fn>(gen), ofs);
+		ofs << "\n#endif // FIX8_CONJURE_ENUM_GEN\n#endif // FIX8_CONJURE_ENUM_CACHE_" << guard << "_\n";
+		return ofs ? 0 : 1;
+	}
+};
+
+//-----------------------------------------------------------------------------------------
+} // FIX8
+
+#endif // FIX8_CONJURE_ENUM_GEN_HPP_
@@ -0,0 +1,71 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------------------
+// conjure_enum range macros; included by conjure_enum.hpp, or on its own with
+// import fix8.conjure_enum
+//----------------------------------------------------------------------------------------
+#ifndef FIX8_CONJURE_ENUM_MACROS_HPP_
+#define FIX8_CONJURE_ENUM_MACROS_HPP_
+
+//-----------------------------------------------------------------------------------------
+// Convenience macros for specialising enum_range (see conjure_enum.hpp)
+//-----------------------------------------------------------------------------------------
+#define FIX8_CONJURE_ENUM_SET_RANGE_INTS(ec,minv,maxv) \
+	template<> struct FIX8::enum_range<ec> final { static constexpr int min{minv}, max{maxv}; };
+
+#define FIX8_CONJURE_ENUM_SET_RANGE(minv,maxv) \
+	FIX8_CONJURE_ENUM_SET_RANGE_INTS(decltype(minv),static_cast<int>(minv), static_cast<int>(maxv))
+
+#define FIX8_CONJURE_ENUM_SET_LARGE_RANGE_INTS(ec,minv,maxv) \
+	template<> struct FIX8::enum_range<ec> final : FIX8::enum_large_range<ec, minv, maxv> {};
+
+#define FIX8_CONJURE_ENUM_SET_LARGE_RANGE(minv,maxv) \
+	FIX8_CONJURE_ENUM_SET_LARGE_RANGE_INTS(decltype(minv),static_cast<int>(minv), static_cast<int>(maxv))
+
+#define FIX8_CONJURE_ENUM_SET_AUTO_RANGE(ec) \
+	template<> struct FIX8::enum_range<ec> final : FIX8::enum_auto_range<ec> {};
+
+#define FIX8_CONJURE_ENUM_SET_AUTO_RANGE_GAP(ec,gap) \
+	template<> struct FIX8::enum_range<ec> final : FIX8::enum_auto_range<ec, gap> {};
+
+#define FIX8_CONJURE_ENUM_SET_FLAGS(ec) \
+	template<> struct FIX8::enum_range<ec> final : FIX8::enum_flags_range<ec> {};
+
+#define FIX8_CONJURE_ENUM_SET_VALUES(ec,...) \
+	template<> struct FIX8::enum_range<ec> final : FIX8::enum_values_range<ec, __VA_ARGS__> {};
+
+//-----------------------------------------------------------------------------------------
+// Convenience macro for specialising enum_traits with its bool members, for example
+// FIX8_CONJURE_ENUM_SET_TRAITS(component, continuous{true}, no_anon{true})
+//-----------------------------------------------------------------------------------------
+#define FIX8_CONJURE_ENUM_SET_TRAITS(ec,...) \
+	template<> struct FIX8::enum_traits<ec> final { static constexpr bool __VA_ARGS__; };
+
+#endif // FIX8_CONJURE_ENUM_MACROS_HPP_
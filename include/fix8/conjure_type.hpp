@@ -33,19 +33,25 @@
 #ifndef FIX8_CONJURE_TYPE_HPP_
 #define FIX8_CONJURE_TYPE_HPP_
 
+//-----------------------------------------------------------------------------------------
+#include <fix8/conjure_enum_core.hpp>
+
 //-----------------------------------------------------------------------------------------
 namespace FIX8 {
 
 //-----------------------------------------------------------------------------------------
-// General purpose class allowing you to extract a string representation of any typename.
-// The string will be stored statically by the compiler, so you can use the statically generated value `name` to obtain your type.
+// Extracts the name of T from the function name of tpeek without copying it. Used by
+// conjure_type and conjure_short_type.
 //-----------------------------------------------------------------------------------------
 template<typename T>
-class conjure_type : public static_only
+class type_peek final : public static_only
 {
-	static constexpr std::string_view _get_name() noexcept
+public:
+	static consteval const char *tpeek() noexcept { return std::source_location::current().function_name(); }
+
+	static constexpr std::string_view get() noexcept
 	{
-		constexpr std::string_view from{tpeek()};
+		constexpr std::string_view from { cs::view(tpeek()) };
 #if defined _MSC_VER
 		constexpr auto ep { from.rfind(cs::get_spec<sval::start,stype::type_t>()) };
 		if constexpr (ep == std::string_view::npos)
@@ -60,24 +66,35 @@ class conjure_type : public static_only
 			CHKMSSTR(e1,extype_t3);
 		}
 		return {};
-	}
 #else
-		constexpr auto ep { from.rfind(cs::get_spec<sval::start,stype::type_t>()) };
+		// the first match starts the template argument list, which the closing bracket ends
+		constexpr auto ep { from.find(cs::get_spec<sval::start,stype::type_t>()) };
 		if constexpr (ep == std::string_view::npos)
 			return {};
-		if constexpr (from[ep + cs::get_spec<sval::start,stype::type_t>().size()] == cs::get_spec<sval::anon_start,stype::type_t>())
-			if (constexpr auto lstr { from.substr(ep + cs::get_spec<sval::start,stype::type_t>().size()) };
-				lstr.find(cs::get_spec<sval::anon_str,stype::type_t>()) != std::string_view::npos)	// is anon
-					if constexpr (constexpr auto lc { lstr.find_first_of(cs::get_spec<sval::end,stype::type_t>()) }; lc != std::string_view::npos)
-						return lstr.substr(cs::get_spec<sval::anon_str,stype::type_t>().size() + 2, lc - (cs::get_spec<sval::anon_str,stype::type_t>().size() + 2)); // eat "::"
 		constexpr auto result { from.substr(ep + cs::get_spec<sval::start,stype::type_t>().size()) };
-		if constexpr (constexpr auto lc { result.find_first_of(cs::get_spec<sval::end,stype::type_t>()) }; lc != std::string_view::npos)
+		constexpr auto lc { result.ends_with(cs::get_spec<sval::end,stype::type_t>()) ? result.size() - 1
+			: result.find_first_of(cs::get_spec<sval::end,stype::type_t>()) };
+		if constexpr (lc == std::string_view::npos)
+			return {};
+		else if constexpr (result.starts_with(cs::get_spec<sval::anon_str,stype::type_t>()))	// is anon
+			return result.substr(cs::get_spec<sval::anon_str,stype::type_t>().size() + 2, lc - (cs::get_spec<sval::anon_str,stype::type_t>().size() + 2)); // eat "::"
+		else
 			return result.substr(0, lc);
-		return {};
+#endif
 	}
+};
+
+//-----------------------------------------------------------------------------------------
+// General purpose class allowing you to extract a string representation of any typename.
+// The string will be stored statically by the compiler, so you can use the statically generated value `name` to obtain your type.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
+class conjure_type : public static_only
+{
+#if not defined _MSC_VER
 	static constexpr auto _type_name() noexcept
 	{
-		constexpr auto result { _get_name() };
+		constexpr auto result { type_peek<T>::get() };
 		return fixed_string<result.size()>(result);
 	}
 #endif
@@ -87,7 +104,7 @@ public:
 	static constexpr auto name
 	{
 #if defined _MSC_VER
-		_get_name()
+		type_peek<T>::get()
 #else
 		_type_name()
 #endif
@@ -102,6 +119,72 @@ public:
 	}
 };
 
+//-----------------------------------------------------------------------------------------
+// Compact alternative to conjure_type for logging and metrics keys. The full name is never
+// copied; only a 64 bit FNV-1a hash of it and a short name are stored. The short name has
+// namespaces and enclosing classes removed and template arguments collapsed, so that
+// std::vector<std::tuple<int, char>> becomes vector<...>. The hash is of the compiler's
+// spelling of the full name, so it is stable for a given compiler but not across compilers.
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_EXPORT template<typename T>
+class conjure_short_type : public static_only
+{
+	static constexpr std::uint64_t _hash(std::string_view what) noexcept
+	{
+		std::uint64_t result { 0xcbf29ce484222325ULL };
+		for (const char *ptr { what.data() }, *const eptr { what.data() + what.size() }; ptr < eptr; ++ptr)
+			result = (result ^ static_cast<unsigned char>(*ptr)) * 0x100000001b3ULL;
+		return result;
+	}
+
+	/// the short name is from[start, open) + "<...>" + from[close + 1, end): the name following the last :: outside
+	/// <> and (), with its template argument list collapsed. Only brackets and colons are visited (see cs::find_any)
+	struct _span { std::size_t start, open, close; };
+
+	static constexpr _span _short_span(std::string_view from) noexcept
+	{
+		constexpr auto npos { std::string_view::npos };
+		_span result { 0, npos, npos };
+		for (std::size_t pos{}, depth{}; (pos = cs::find_any(from, depth ? "<>()" : "<>():", pos)) != npos; ++pos)
+		{
+			if (const char cc { from[pos] }; cc == ':')
+			{
+				if (pos + 1 < from.size() && from[pos + 1] == ':')
+					result = { ++pos + 1, npos, npos };
+			}
+			else if (cc == '<' || cc == '(')
+			{
+				if (!depth++ && cc == '<' && pos > result.start && result.open == npos) // names such as <lambda()> are kept
+					result.open = pos;
+			}
+			else if (depth && !--depth && result.open != npos && result.close == npos)
+				result.close = pos;
+		}
+		return result;
+	}
+
+	static constexpr auto _short_name() noexcept
+	{
+		constexpr std::string_view from { type_peek<T>::get() };
+		constexpr auto span { _short_span(from) };
+		constexpr bool collapse { span.open != std::string_view::npos && span.close != std::string_view::npos };
+		constexpr std::string_view head { from.substr(span.start, collapse ? span.open - span.start : std::string_view::npos) },
+			mid { collapse ? "<...>" : "" }, tail { collapse ? from.substr(span.close + 1) : "" };
+		fixed_array<char, head.size() + mid.size() + tail.size()> buff{};
+		std::size_t len{};
+		const std::string_view parts[] { head, mid, tail };
+		for (const std::string_view part : parts)
+			for (const char cc : part)
+				buff[len++] = cc;
+		return fixed_string<buff.size()>(std::string_view(buff.begin(), buff.size()));
+	}
+
+public:
+	static constexpr std::uint64_t hash { _hash(type_peek<T>::get()) };
+	static constexpr auto name { _short_name() };
+	static constexpr std::string_view as_string_view() noexcept { return name.get(); }
+};
+
 //-----------------------------------------------------------------------------------------
 } // FIX8
 
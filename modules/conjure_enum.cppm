@@ -0,0 +1,72 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//----------------------------------------------------------------------------------------
+// fix8.conjure_enum module interface unit (experimental, unverified; see the README)
+// Exports conjure_enum, conjure_enum_core, enum_bitset, conjure_type and their customisation
+// points (enum_range, enum_auto_range, enum_flags_range, enum_values_range, enum_cache, enum_traits). Configuration macros must be defined when
+// this unit is built (see the cmake target conjure_enum_module); per enum ranges and optimizations are set by
+// specialising enum_range and enum_traits in the importing translation unit, for which the convenience macros
+// can be had from <fix8/conjure_enum_macros.hpp>.
+//----------------------------------------------------------------------------------------
+module;
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <source_location>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if __has_include(<format>)
+# include <format>
+#else
+# include <sstream>
+#endif
+#if defined FIX8_CONJURE_ENUM_PROFILE
+# include <atomic>
+# include <fstream>
+#endif
+
+export module fix8.conjure_enum;
+
+#define FIX8_CONJURE_ENUM_EXPORT export
+#include <fix8/conjure_enum.hpp>
+#include <fix8/conjure_enum_bitset.hpp>
+#include <fix8/conjure_type.hpp>
@@ -0,0 +1,233 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <catch2/catch_test_macros.hpp>
+#include <string_view>
+#include <fix8/conjure_enum_core.hpp> // conjure_enum.hpp is deliberately not included
+
+//-----------------------------------------------------------------------------------------
+using namespace FIX8;
+
+//-----------------------------------------------------------------------------------------
+enum class component : int { scheme, authority, userinfo, user, password, host, port, path=12, test=path, query, fragment };
+enum component1 : int { scheme, authority, userinfo, user, password, host, port, path=12, query, fragment };
+enum class numbers { zero, one, two, three, four, five, six, seven, eight, nine };
+enum class flags : unsigned { none, read=1 << 0, write=1 << 1, exec=1 << 2, all=1U << 31 };
+FIX8_CONJURE_ENUM_SET_FLAGS(flags)
+enum class sparse : short { a=-100, b=-37, c, d=3, e=27, f, g=91, h=127 };
+enum class sparse8 : unsigned char { a=2, b=30, c=100, d=101 };
+enum class error_codes : int { fatal=-70000, ok=1, busy=1000, moved=1001, gone=65000, lost=1 << 30 };
+FIX8_CONJURE_ENUM_SET_VALUES(error_codes, error_codes::fatal, error_codes::ok, error_codes::busy, error_codes::moved, error_codes::gone, error_codes::lost)
+namespace
+{
+	enum class anon_test { first=-3, second=10, third=100 };
+}
+namespace market::fix44::session
+{
+	enum class msg_type : int { msg_new_order, msg_exec_report, msg_cancel, msg_cancel_replace, msg_reject };
+}
+using market::fix44::session::msg_type;
+enum class long_names { short_name, a_name_well_beyond_the_thirty_two_bytes_of_a_slot };
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core enum_to_string")
+{
+	using ec = conjure_enum_core<component>;
+	STATIC_REQUIRE(ec::count() == 10);
+	STATIC_REQUIRE(!ec::is_continuous());
+	REQUIRE(ec::enum_to_string(component::path) == "component::path");
+	REQUIRE(ec::enum_to_string(component::test) == "component::path");
+	REQUIRE(ec::enum_to_string(static_cast<component>(100)).empty());
+	REQUIRE(ec::enum_to_string<component::fragment>() == "component::fragment");
+	REQUIRE(conjure_enum_core<component1>::enum_to_string(query) == "query");
+	REQUIRE(conjure_enum_core<numbers>::enum_to_string(numbers::nine) == "numbers::nine");
+	REQUIRE(conjure_enum_core<anon_test>::enum_to_string(anon_test::third) == "anon_test::third");
+	REQUIRE(ec::enum_to_string(component::path, true) == "path");
+	REQUIRE(ec::enum_to_string(static_cast<component>(100), true).empty());
+	REQUIRE(conjure_enum_core<component1>::enum_to_string(query, true) == "query");
+	REQUIRE(conjure_enum_core<anon_test>::enum_to_string(anon_test::third, true) == "third");
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core string_to_enum")
+{
+	using ec = conjure_enum_core<component>;
+	STATIC_REQUIRE(ec::string_to_enum("component::host") == component::host);
+	REQUIRE(ec::string_to_enum("component::path") == component::path);
+	REQUIRE(!ec::string_to_enum("component::bad"));
+	REQUIRE(!ec::string_to_enum("path"));
+	REQUIRE(ec::string_to_enum("component::bad").value_or(component::port) == component::port);
+	REQUIRE(*conjure_enum_core<component1>::string_to_enum("scheme") == scheme);
+	REQUIRE(conjure_enum_core<anon_test>::string_to_enum("anon_test::first") == anon_test::first);
+	REQUIRE(conjure_enum_core<flags>::string_to_enum("flags::read|flags::exec") == static_cast<flags>(5));
+	REQUIRE(!conjure_enum_core<flags>::string_to_enum("flags::read|flags::bad"));
+	REQUIRE(ec::any_string_to_enum("component::path") == component::path);
+	REQUIRE(ec::any_string_to_enum("path") == component::path);
+	REQUIRE(!ec::any_string_to_enum("bad"));
+	REQUIRE(ec::nocase_string_to_enum("Component::Path") == component::path);
+	const char *cstr { "component::host" };
+	REQUIRE(ec::string_to_enum(cstr) == component::host);
+	REQUIRE(!ec::string_to_enum(static_cast<const char *>("component::hos")));
+	REQUIRE(!ec::nocase_string_to_enum("PATH"));
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core contains and index")
+{
+	using ec = conjure_enum_core<component>;
+	STATIC_REQUIRE(ec::contains(component::password));
+	REQUIRE(!ec::contains(static_cast<component>(7)));
+	REQUIRE(ec::contains("component::query"));
+	REQUIRE(!ec::contains("query"));
+	REQUIRE(ec::contains<component::scheme>());
+	REQUIRE(ec::index(component::path) == 7U);
+	REQUIRE(ec::index<component::fragment>() == 9U);
+	REQUIRE(!ec::index(static_cast<component>(7)));
+	using en = conjure_enum_core<numbers>;
+	STATIC_REQUIRE(en::is_continuous());
+	REQUIRE(en::index(numbers::five) == 5U);
+	REQUIRE(!en::index(static_cast<numbers>(10)));
+	REQUIRE(en::min_v == numbers::zero);
+	REQUIRE(en::max_v == numbers::nine);
+	REQUIRE(conjure_enum_core<flags>::index(flags::all) == 4U);
+	REQUIRE(!conjure_enum_core<flags>::contains(static_cast<flags>(3)));
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core common name prefix")
+{
+	using ec = conjure_enum_core<msg_type>; // every name starts "market::fix44::session::msg_type::msg_"
+	REQUIRE(ec::string_to_enum("market::fix44::session::msg_type::msg_cancel") == msg_type::msg_cancel);
+	REQUIRE(ec::string_to_enum("market::fix44::session::msg_type::msg_cancel_replace") == msg_type::msg_cancel_replace);
+	REQUIRE(!ec::string_to_enum("market::fix44::session::msg_type::msg_"));
+	REQUIRE(!ec::string_to_enum("msg_cancel"));
+	REQUIRE(ec::any_string_to_enum("msg_reject") == msg_type::msg_reject);
+	STATIC_REQUIRE(ec::contains("market::fix44::session::msg_type::msg_exec_report"));
+	for (std::size_t idx{}; idx < ec::count(); ++idx)
+	{
+		const auto name { ec::enum_to_string(static_cast<msg_type>(idx)) };
+		char str[64]{};
+		for (std::size_t pos{}; pos < name.size(); ++pos)
+			str[pos] = name[pos];
+		for (std::size_t pos{}; pos < name.size(); ++pos) // a change before, within or after the common prefix
+		{
+			str[pos] = '~';
+			REQUIRE(!ec::string_to_enum(std::string_view(str, name.size())));
+			str[pos] = name[pos];
+		}
+		REQUIRE(ec::string_to_enum(std::string_view(str, name.size())) == static_cast<msg_type>(idx));
+	}
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core direct value table")
+{
+	using ec = conjure_enum_core<sparse>;
+	STATIC_REQUIRE(!ec::is_continuous());
+	STATIC_REQUIRE(ec::index(sparse::h) == 7U);
+	STATIC_REQUIRE(!ec::contains(static_cast<sparse>(-101)));
+	for (int val { -128 }; val <= 127; ++val) // values below and above the range, and either side of bitmap word boundaries
+	{
+		const auto ev { static_cast<sparse>(val) };
+		const bool found { val == -100 || val == -37 || val == -36 || val == 3 || val == 27 || val == 28 || val == 91 || val == 127 };
+		REQUIRE(ec::contains(ev) == found);
+		REQUIRE(ec::index(ev).has_value() == found);
+		REQUIRE(ec::enum_to_string(ev).empty() == !found);
+	}
+	REQUIRE(ec::index(sparse::f) == 5U);
+	REQUIRE(ec::enum_to_string(sparse::b) == "sparse::b");
+	using e8 = conjure_enum_core<sparse8>;
+	REQUIRE(!e8::contains(static_cast<sparse8>(0)));
+	REQUIRE(!e8::contains(static_cast<sparse8>(255)));
+	REQUIRE(e8::index(sparse8::d) == 3U);
+	REQUIRE(e8::enum_to_string(sparse8::c) == "sparse8::c");
+	REQUIRE(conjure_enum_core<anon_test>::index(anon_test::third) == 2U);
+	REQUIRE(!conjure_enum_core<anon_test>::contains(static_cast<anon_test>(99)));
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core value hash")
+{
+	using ec = conjure_enum_core<error_codes>;
+	STATIC_REQUIRE(ec::index(error_codes::gone) == 4U);
+	STATIC_REQUIRE(!ec::contains(static_cast<error_codes>(0)));
+	for (std::size_t idx{}; const auto val : { -70000, 1, 1000, 1001, 65000, 1 << 30 })
+	{
+		REQUIRE(ec::index(static_cast<error_codes>(val)) == idx++);
+		REQUIRE(ec::contains(static_cast<error_codes>(val)));
+	}
+	for (const auto val : { -70001, -1, 0, 2, 999, 1002, 64999, 1 << 29, 0x7fffffff, -0x7fffffff - 1 })
+	{
+		REQUIRE(!ec::contains(static_cast<error_codes>(val)));
+		REQUIRE(!ec::index(static_cast<error_codes>(val)));
+		REQUIRE(ec::enum_to_string(static_cast<error_codes>(val)).empty());
+	}
+	REQUIRE(ec::enum_to_string(error_codes::fatal) == "error_codes::fatal");
+	REQUIRE(ec::enum_to_string(error_codes::lost) == "error_codes::lost");
+	REQUIRE(conjure_enum_core<flags>::index(flags::exec) == 3U);
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core lookup strategy")
+{
+	constexpr auto s1 { conjure_enum_core<numbers>::strategy() };
+	STATIC_REQUIRE(s1.values == value_lookup::continuous);
+	STATIC_REQUIRE(s1.value_bytes == 0);
+	STATIC_REQUIRE(s1.value_probes == 0);
+	STATIC_REQUIRE(s1.names == name_lookup::slots);
+	STATIC_REQUIRE(s1.name_probes == 3); // displacement, slot and the scope
+	constexpr auto s2 { conjure_enum_core<sparse>::strategy() };
+	STATIC_REQUIRE(s2.values == value_lookup::direct);
+	STATIC_REQUIRE(s2.value_bytes >= 228 + 4 * 8); // an index for each of the 228 values spanned and a bitmap of them
+	STATIC_REQUIRE(s2.value_probes == 1);
+	constexpr auto s3 { conjure_enum_core<error_codes>::strategy() };
+	STATIC_REQUIRE(s3.values == value_lookup::hash);
+	STATIC_REQUIRE(s3.value_probes == 3);
+	STATIC_REQUIRE(s3.name_bytes > s3.value_bytes);
+	constexpr auto s4 { conjure_enum_core<long_names>::strategy() };
+	STATIC_REQUIRE(s4.names == name_lookup::keys);
+	STATIC_REQUIRE(s4.name_probes == 4); // the rest of the long name too
+	STATIC_REQUIRE(conjure_enum_core<component1>::strategy().name_probes == 2); // no scope and no common prefix
+	STATIC_REQUIRE(conjure_enum_core<long_names>::string_to_enum("long_names::a_name_well_beyond_the_thirty_two_bytes_of_a_slot") == long_names::a_name_well_beyond_the_thirty_two_bytes_of_a_slot);
+	REQUIRE(!conjure_enum_core<long_names>::string_to_enum("long_names::a_name_well_beyond_the_thirty_two_bytes_of_a_slob"));
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("core_optional")
+{
+	constexpr core_optional<int> empty, one{1};
+	STATIC_REQUIRE(!empty.has_value());
+	STATIC_REQUIRE(one.has_value());
+	STATIC_REQUIRE(*one == 1);
+	STATIC_REQUIRE(one == 1);
+	STATIC_REQUIRE(!(empty == 0));
+	STATIC_REQUIRE(empty.value_or(2) == 2);
+	STATIC_REQUIRE(empty == core_optional<int>{});
+	STATIC_REQUIRE(!(one == empty));
+}
@@ -231,6 +231,8 @@ TEST_CASE("nested namespaced entries")
    };
 	REQUIRE(conjure_enum<TEST::TEST1::NineEnums>::entries == compentries);
 	REQUIRE(conjure_enum<TEST::TEST1::NineEnums1>::entries == compentries1);
+	REQUIRE(conjure_enum<TEST::TEST1::NineEnums>::enum_to_string(TEST::TEST1::NineEnums::Seven, true) == "Seven");
+	REQUIRE(conjure_enum<TEST::TEST1::NineEnums1>::enum_to_string(TEST::TEST1::Seven, true) == "TEST::TEST1::Seven"); // as remove_scope
 }
 
 //-----------------------------------------------------------------------------------------
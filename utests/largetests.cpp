@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------------------
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright (C) 2024 Fix8 Market Technologies Pty Ltd
+// SPDX-FileType: SOURCE
+//
+// conjure_enum (header only)
+//   by David L. Dight
+// see https://github.com/fix8mt/conjure_enum
+//
+// Lightweight header-only C++20 enum and typename reflection
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice (including the next paragraph)
+// shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+// PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <fix8/conjure_enum.hpp>
+
+//-----------------------------------------------------------------------------------------
+using namespace FIX8;
+
+//-----------------------------------------------------------------------------------------
+// 10,000 enumerators v0000 to v9999; the digits are shuffled at each level so that name
+// order differs from value order (value 0 is v3333, value 9999 is v4444)
+//-----------------------------------------------------------------------------------------
+#define LARGE_D10(p) p##3, p##7, p##1, p##9, p##5, p##0, p##8, p##2, p##6, p##4
+#define LARGE_D100(p) LARGE_D10(p##3), LARGE_D10(p##7), LARGE_D10(p##1), LARGE_D10(p##9), LARGE_D10(p##5), \
+	LARGE_D10(p##0), LARGE_D10(p##8), LARGE_D10(p##2), LARGE_D10(p##6), LARGE_D10(p##4)
+#define LARGE_D1000(p) LARGE_D100(p##3), LARGE_D100(p##7), LARGE_D100(p##1), LARGE_D100(p##9), LARGE_D100(p##5), \
+	LARGE_D100(p##0), LARGE_D100(p##8), LARGE_D100(p##2), LARGE_D100(p##6), LARGE_D100(p##4)
+#define LARGE_D10000(p) LARGE_D1000(p##3), LARGE_D1000(p##7), LARGE_D1000(p##1), LARGE_D1000(p##9), LARGE_D1000(p##5), \
+	LARGE_D1000(p##0), LARGE_D1000(p##8), LARGE_D1000(p##2), LARGE_D1000(p##6), LARGE_D1000(p##4)
+
+enum class large_test : int { LARGE_D10000(v) };
+FIX8_CONJURE_ENUM_SET_RANGE_INTS(large_test, 0, 9999) // wider than FIX8_CONJURE_ENUM_LARGE_THRESHOLD
+
+// the same sparse enum reflected normally and in large enum mode
+namespace normal { enum sparse_test : int { LARGE_D100(s), minus_one=-1, big=1000 }; }
+namespace large { enum sparse_test : int { LARGE_D100(s), minus_one=-1, big=1000 }; }
+FIX8_CONJURE_ENUM_SET_RANGE_INTS(normal::sparse_test, -1, 1000)
+FIX8_CONJURE_ENUM_SET_LARGE_RANGE(large::minus_one, large::big)
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("large enum")
+{
+	using ec = conjure_enum<large_test>;
+	static_assert(ec::count() == 10000);
+	STATIC_REQUIRE(ec::is_continuous());
+	REQUIRE(ec::enum_to_string(static_cast<large_test>(0)) == "large_test::v3333");
+	REQUIRE(ec::enum_to_string(static_cast<large_test>(9999)) == "large_test::v4444");
+	REQUIRE(ec::enum_to_string<static_cast<large_test>(5555)>() == "large_test::v0000");
+	REQUIRE(ec::string_to_enum("large_test::v0000") == static_cast<large_test>(5555));
+	REQUIRE(ec::string_to_enum("large_test::v9999") == static_cast<large_test>(3333));
+	REQUIRE(!ec::string_to_enum("large_test::v10000"));
+	REQUIRE(ec::unscoped_string_to_enum("v1234") == static_cast<large_test>(2709));
+	REQUIRE(ec::add_scope("v1234") == "large_test::v1234");
+	REQUIRE(ec::remove_scope("large_test::v1234") == "v1234");
+	REQUIRE(ec::names[0] == "large_test::v3333");
+	REQUIRE(ec::unscoped_names[9999] == "v4444");
+	REQUIRE(std::get<std::string_view>(ec::sorted_entries.front()) == "large_test::v0000");
+	REQUIRE(std::get<std::string_view>(ec::sorted_entries.back()) == "large_test::v9999");
+	REQUIRE(std::is_sorted(ec::sorted_entries.cbegin(), ec::sorted_entries.cend(), [](const auto& pl, const auto& pr)
+		{ return std::get<std::string_view>(pl) < std::get<std::string_view>(pr); }));
+	REQUIRE(std::is_sorted(ec::scoped_entries.cbegin(), ec::scoped_entries.cend()));
+	REQUIRE(std::is_sorted(ec::rev_scoped_entries.cbegin(), ec::rev_scoped_entries.cend()));
+	for (const auto& [value, name] : ec::sorted_entries)
+		REQUIRE(ec::string_to_enum(name) == value);
+	for (const auto& [value, name] : ec::unscoped_entries)
+		REQUIRE(ec::unscoped_string_to_enum(name) == value);
+}
+
+TEST_CASE("large enum name keys")
+{
+	using ec = conjure_enum<large_test>;
+	for (std::size_t idx{}; idx < ec::count(); idx += 97)
+	{
+		REQUIRE(ec::remove_scope(ec::names[idx]) == ec::unscoped_names[idx]);
+		REQUIRE(ec::add_scope(ec::unscoped_names[idx]) == ec::names[idx]);
+		std::string scoped { ec::names[idx] }, unscoped { ec::unscoped_names[idx] };
+		for (auto& chr : scoped)
+		{
+			const auto save { chr };
+			chr = '~';
+			REQUIRE(!ec::string_to_enum(scoped));
+			chr = save;
+		}
+		for (auto& chr : unscoped)
+		{
+			const auto save { chr };
+			chr = '~';
+			REQUIRE(!ec::unscoped_string_to_enum(unscoped));
+			chr = save;
+		}
+		REQUIRE(ec::string_to_enum(scoped) == ec::values[idx]);
+		REQUIRE(ec::unscoped_string_to_enum(unscoped) == ec::values[idx]);
+	}
+	REQUIRE(!ec::string_to_enum(""));
+	REQUIRE(!ec::unscoped_string_to_enum("v"));
+	REQUIRE(ec::remove_scope("large_test::v") == "large_test::v");
+	REQUIRE(ec::add_scope("v12345") == "v12345");
+
+	using en = conjure_enum<normal::sparse_test>; // names of 11 to 17 bytes that share their first 8, "normal::"
+	for (const auto& [value, name] : en::entries)
+	{
+		std::string str { name };
+		for (auto& chr : str)
+		{
+			const auto save { chr };
+			chr = '~';
+			REQUIRE(!en::string_to_enum(str));
+			chr = save;
+		}
+		REQUIRE(en::string_to_enum(str) == value);
+		REQUIRE(en::remove_scope(str) == str);
+	}
+}
+
+TEST_CASE("large enum mode matches")
+{
+	using en = conjure_enum<normal::sparse_test>;
+	using el = conjure_enum<large::sparse_test>;
+	REQUIRE(el::count() == 102);
+	REQUIRE(en::count() == el::count());
+	for (std::size_t idx{}; idx < el::count(); ++idx)
+	{
+		REQUIRE(static_cast<int>(en::values[idx]) == static_cast<int>(el::values[idx]));
+		REQUIRE(en::unscoped_names[idx] == el::unscoped_names[idx]);
+		REQUIRE(static_cast<int>(std::get<0>(en::sorted_entries[idx])) == static_cast<int>(std::get<0>(el::sorted_entries[idx])));
+		REQUIRE(static_cast<int>(std::get<0>(en::unscoped_entries[idx])) == static_cast<int>(std::get<0>(el::unscoped_entries[idx])));
+		REQUIRE(std::get<0>(en::scoped_entries[idx]) == std::get<0>(el::scoped_entries[idx]));
+		REQUIRE(std::get<1>(en::rev_scoped_entries[idx]) == std::get<1>(el::rev_scoped_entries[idx]));
+	}
+	REQUIRE(el::enum_to_string(large::big) == "large::big");
+	REQUIRE(el::string_to_enum("large::minus_one") == large::minus_one);
+}
@@ -69,6 +69,21 @@ enum class numbers64
 	sixty, sixty_one, sixty_two, sixty_three
 };
 enum class reverse_range_test { first=7, second=6, third=5, fourth=4, fifth=3, sixth=2, seventh=1, eighth=0 };
+enum class offset_range_test { first=3, second, third };
+enum class auto_range_test : unsigned char { first=130, second=200, third=255 };
+enum class auto_range_test1 : unsigned short { hello=1000, bye=1005, ack=1040, nak=1099 };
+enum class auto_range_test2 : short { below=-300, lower=-290, zero=0, upper=100 };
+enum class gap_test { a=0, b=1, c=500 };
+enum class gap_test1 : unsigned char { a=0, b=1, c=200 };
+enum class cache_test : int { beta=-100000, alpha=100000 };
+enum class flags_test : unsigned long long { none, read=1 << 0, write=1 << 1, exec=1 << 2, admin=1ULL << 40, read_write=read|write };
+enum class ids_test : std::uint64_t { first=0x10000, second=0x7FFF0001, third=1ULL << 40, last=0xFFFFFFFFFFFFFFFF, second_alias=second };
+enum codes_test : long long { neg=-(1LL << 50), zero=0, pos=1LL << 50 };
+enum class msg_test : std::uint32_t { heartbeat=0x30, logon=0x41, mass_quote_acknowledgement_with_legs=0x44, order=0x1000, cancel=0x2000,
+	quote=0x100000, reject=0x7fffffff };
+enum class traits_test : int { alpha=1000, beta, gamma, delta };
+enum class traits_test1 { first, second, third, fourth };
+namespace profile_ns { enum profile_test { bid, offer, trade }; }
 
 //-----------------------------------------------------------------------------------------
 // run as: ctest --output-on-failure
@@ -132,6 +147,213 @@ TEST_CASE("custom range (alias)")
 	REQUIRE(conjure_enum<range_test4>::get_enum_max_value() == 7);
 }
 
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_SET_AUTO_RANGE(auto_range_test)
+FIX8_CONJURE_ENUM_SET_AUTO_RANGE_GAP(auto_range_test1, 64)
+FIX8_CONJURE_ENUM_SET_AUTO_RANGE_GAP(gap_test, 512)
+FIX8_CONJURE_ENUM_SET_AUTO_RANGE(gap_test1)
+template<>
+struct FIX8::enum_range<auto_range_test2> final : FIX8::enum_auto_range<auto_range_test2, 512> {};
+
+TEST_CASE("auto range")
+{
+	REQUIRE(conjure_enum<auto_range_test>::get_enum_min_value() == 128);
+	REQUIRE(conjure_enum<auto_range_test>::get_enum_max_value() == 255);
+	REQUIRE(conjure_enum<auto_range_test>::count() == 3);
+	REQUIRE(conjure_enum<auto_range_test>::get_actual_enum_max_value() == 255);
+	REQUIRE(conjure_enum<auto_range_test>::enum_to_string(auto_range_test::second) == "auto_range_test::second");
+	REQUIRE(conjure_enum<auto_range_test1>::count() == 4);
+	REQUIRE(conjure_enum<auto_range_test1>::get_actual_enum_min_value() == 1000);
+	REQUIRE(conjure_enum<auto_range_test1>::get_actual_enum_max_value() == 1099);
+	REQUIRE(conjure_enum<auto_range_test1>::string_to_enum("auto_range_test1::ack") == auto_range_test1::ack);
+	REQUIRE(conjure_enum<auto_range_test2>::count() == 4);
+	REQUIRE(conjure_enum<auto_range_test2>::get_actual_enum_min_value() == -300);
+	REQUIRE(conjure_enum<auto_range_test2>::get_actual_enum_max_value() == 100);
+	REQUIRE(conjure_enum<gap_test>::count() == 3);
+	REQUIRE(conjure_enum<gap_test>::get_actual_enum_max_value() == 500);
+	REQUIRE(conjure_enum<gap_test>::string_to_enum("gap_test::c") == gap_test::c);
+	REQUIRE(conjure_enum<gap_test1>::count() == 3); // 8 bit types are searched without a gap
+	REQUIRE(conjure_enum<gap_test1>::get_actual_enum_max_value() == 200);
+}
+
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_SET_FLAGS(flags_test)
+
+TEST_CASE("flags")
+{
+	using ec = conjure_enum<flags_test>;
+	REQUIRE(ec::count() == 5); // composite enumerators are not single bits so are not reflected
+	REQUIRE(ec::values == std::array<flags_test, 5>{ flags_test::none, flags_test::read, flags_test::write, flags_test::exec, flags_test::admin });
+	REQUIRE(ec::enum_to_string(flags_test::admin) == "flags_test::admin");
+	REQUIRE(ec::enum_to_string(flags_test::read_write).empty());
+	REQUIRE(ec::string_to_enum("flags_test::exec") == flags_test::exec);
+	REQUIRE(ec::string_to_enum("flags_test::read|flags_test::write") == flags_test::read_write);
+	REQUIRE(ec::string_to_enum("flags_test::read|flags_test::admin") == static_cast<flags_test>(1 | 1ULL << 40));
+	REQUIRE(!ec::string_to_enum("flags_test::read|"));
+	REQUIRE(!ec::string_to_enum("flags_test::read|flags_test::bogus"));
+	REQUIRE(ec::flags_to_string(flags_test::none) == "flags_test::none");
+	REQUIRE(ec::flags_to_string(flags_test::read_write) == "flags_test::read|flags_test::write");
+	REQUIRE(ec::flags_to_string(static_cast<flags_test>(1 | 4 | 1ULL << 40), true) == "read|exec|admin");
+	REQUIRE(ec::flags_to_string(static_cast<flags_test>(1 | 8)).empty()); // bit 3 has no name
+}
+
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_SET_VALUES(ids_test, ids_test::last, ids_test::second, ids_test::first, ids_test::third, ids_test::second_alias)
+FIX8_CONJURE_ENUM_SET_VALUES(codes_test, pos, zero, neg)
+
+TEST_CASE("declared values")
+{
+	using ec = conjure_enum<ids_test>;
+	REQUIRE(ec::count() == 4); // the alias is ignored
+	REQUIRE(ec::values == std::array<ids_test, 4>{ ids_test::first, ids_test::second, ids_test::third, ids_test::last });
+	REQUIRE(ec::enum_to_string(ids_test::third) == "ids_test::third");
+	REQUIRE(ec::enum_to_string<ids_test::last>() == "ids_test::last");
+	REQUIRE(ec::enum_to_string(static_cast<ids_test>(0x10001)).empty());
+	REQUIRE(ec::string_to_enum("ids_test::second") == ids_test::second);
+	REQUIRE(ec::contains(ids_test::last));
+	REQUIRE(!ec::contains(static_cast<ids_test>(1)));
+	REQUIRE(ec::index(ids_test::third) == 2);
+	REQUIRE(ec::underlying_to_enum(0xFFFFFFFFFFFFFFFF) == ids_test::last);
+	REQUIRE(!ec::underlying_to_enum(0x7FFF0000));
+	REQUIRE(ec::get_enum_min_value() == 0); // probe indices
+	REQUIRE(ec::get_enum_max_value() == 3);
+
+	using ec1 = conjure_enum<codes_test>;
+	REQUIRE(ec1::count() == 3);
+	REQUIRE(ec1::min_v == neg);
+	REQUIRE(ec1::max_v == pos);
+	REQUIRE(ec1::enum_to_string(neg) == "neg");
+	REQUIRE(ec1::string_to_enum("pos") == pos);
+	REQUIRE(ec1::underlying_to_enum(-(1LL << 50)) == neg);
+	REQUIRE(!ec1::underlying_to_enum(1));
+}
+
+//-----------------------------------------------------------------------------------------
+FIX8_CONJURE_ENUM_SET_VALUES(msg_test, msg_test::heartbeat, msg_test::logon, msg_test::mass_quote_acknowledgement_with_legs, msg_test::order,
+	msg_test::cancel, msg_test::quote, msg_test::reject)
+
+TEST_CASE("hashed values")
+{
+	using ec = conjure_enum<msg_test>;
+	for (const auto& [value, name] : ec::entries)
+	{
+		REQUIRE(ec::string_to_enum(name) == value);
+		REQUIRE(ec::enum_to_string(value) == name);
+		REQUIRE(ec::values[*ec::index(value)] == value);
+		REQUIRE(ec::unscoped_string_to_enum(ec::remove_scope(name)) == value);
+	}
+	REQUIRE(ec::index(msg_test::quote) == 5);
+	REQUIRE(!ec::string_to_enum("msg_test::mass_quote_acknowledgement_with_legz")); // differs in the last byte
+	REQUIRE(!ec::string_to_enum("msg_test::quotf"));
+	REQUIRE(!ec::string_to_enum("msg_tesx::quote")); // known suffix, wrong prefix
+	REQUIRE(!ec::string_to_enum(""));
+	REQUIRE(!ec::contains(static_cast<msg_test>(0x31)));
+	REQUIRE(ec::enum_to_string(static_cast<msg_test>(0x100001)).empty());
+	STATIC_REQUIRE(ec::string_to_enum("msg_test::heartbeat") == msg_test::heartbeat);
+	STATIC_REQUIRE(ec::enum_to_string(msg_test::quote) == "msg_test::quote");
+	STATIC_REQUIRE(ec::strategy().values == value_lookup::hash);
+	REQUIRE(conjure_enum<value_lookup>::enum_to_string(ec::strategy().values, true) == "hash");
+	REQUIRE(conjure_enum<name_lookup>::enum_to_string(ec::strategy().names, true) == "keys"); // one name is too long for a slot
+}
+
+#if defined FIX8_CONJURE_ENUM_PROFILE
+TEST_CASE("profile")
+{
+	using ec = conjure_enum<msg_test>;
+	ec::profile_reset();
+	for (int ii{}; ii < 3; ++ii)
+		REQUIRE(ec::string_to_enum("msg_test::order") == msg_test::order);
+	REQUIRE(ec::unscoped_string_to_enum("order") == msg_test::order);
+	REQUIRE(ec::string_to_enum("msg_test::cancel") == msg_test::cancel);
+	REQUIRE(!ec::string_to_enum("msg_test::orders")); // misses are not counted
+	REQUIRE(ec::enum_to_string(msg_test::cancel) == "msg_test::cancel");
+	const auto dd1 { std::to_array<std::tuple<msg_test, int(*)(msg_test)>>({ { msg_test::logon, [](msg_test) { return 1; } } }) };
+	REQUIRE(ec::dispatch(msg_test::logon, -1, dd1) == 1);
+	REQUIRE(ec::dispatch(msg_test::reject, -1, dd1) == -1);
+	REQUIRE(ec::profile_hits(msg_test::order) == std::tuple { 4ULL, 0ULL, 0ULL });
+	REQUIRE(ec::profile_hits(msg_test::cancel) == std::tuple { 1ULL, 1ULL, 0ULL });
+	REQUIRE(ec::profile_hits(msg_test::logon) == std::tuple { 0ULL, 0ULL, 1ULL });
+	REQUIRE(ec::profile_hits(msg_test::reject) == std::tuple { 0ULL, 0ULL, 0ULL });
+	std::ostringstream ostr;
+	ec::profile_write(ostr);
+	REQUIRE(ostr.str() == "// conjure_enum profile: msg_test; hits by string_to_enum, enum_to_string, dispatch\n"
+		"//   msg_test::order 4 0 0\n//   msg_test::cancel 1 1 0\n//   msg_test::logon 0 0 1\n");
+	ostr.str("");
+	ec::profile_write(ostr, "ns::msg_test");
+	REQUIRE(ostr.str().starts_with("// conjure_enum profile: ns::msg_test;"));
+	ec::profile_reset();
+	REQUIRE(ec::profile_hits(msg_test::order) == std::tuple { 0ULL, 0ULL, 0ULL });
+	ostr.str("");
+	ec::profile_write(ostr);
+	REQUIRE(ostr.str() == "// conjure_enum profile: msg_test; hits by string_to_enum, enum_to_string, dispatch\n");
+
+	// unscoped enum in a namespace; enumerators keep their namespace but not the enum name
+	using ec1 = conjure_enum<profile_ns::profile_test>;
+	ec1::profile_reset();
+	REQUIRE(ec1::string_to_enum("profile_ns::trade") == profile_ns::trade);
+	REQUIRE(ec1::enum_to_string(profile_ns::bid) == "profile_ns::bid");
+	REQUIRE(ec1::enum_to_string(profile_ns::trade) == "profile_ns::trade");
+	ostr.str("");
+	ec1::profile_write(ostr);
+	REQUIRE(ostr.str() == "// conjure_enum profile: profile_ns::profile_test; hits by string_to_enum, enum_to_string, dispatch\n"
+		"//   profile_ns::trade 1 1 0\n//   profile_ns::bid 0 1 0\n");
+}
+#endif
+
+//-----------------------------------------------------------------------------------------
+template<>
+struct FIX8::enum_traits<traits_test>
+{
+	static constexpr bool continuous{true}, no_anon{true}, extended{false};
+	static constexpr int min{1000}, max{1003};
+};
+FIX8_CONJURE_ENUM_SET_RANGE(traits_test1::first, traits_test1::fourth)
+FIX8_CONJURE_ENUM_SET_TRAITS(traits_test1, continuous{true})
+
+template<typename T>
+concept has_unscoped_api = requires { conjure_enum<T>::remove_scope(""); conjure_enum<T>::unscoped_string_to_enum(""); };
+
+TEST_CASE("enum_traits")
+{
+	using ec = conjure_enum<traits_test>;
+	STATIC_REQUIRE(enum_range<traits_test>::min == 1000 && enum_range<traits_test>::max == 1003);
+	STATIC_REQUIRE(ec::count() == 4);
+	STATIC_REQUIRE(ec::values == std::array { traits_test::alpha, traits_test::beta, traits_test::gamma, traits_test::delta });
+	REQUIRE(ec::enum_to_string(traits_test::gamma) == "traits_test::gamma");
+	REQUIRE(ec::string_to_enum("traits_test::delta") == traits_test::delta);
+	REQUIRE(ec::index(traits_test::beta) == 1);
+	REQUIRE(ec::entries.size() == 4);
+	STATIC_REQUIRE(ec::names.empty() && ec::unscoped_names.empty() && ec::scoped_entries.empty());
+	STATIC_REQUIRE(!has_unscoped_api<traits_test>);
+	STATIC_REQUIRE(ec::dispatch(traits_test::beta, -1, std::to_array<std::tuple<traits_test, int(*)(traits_test)>>({
+		{ traits_test::beta, [](traits_test) { return 1; } } })) == 1);
+
+	STATIC_REQUIRE(conjure_enum<traits_test1>::count() == 4); // continuous, in the range from its enum_range
+	STATIC_REQUIRE(conjure_enum<traits_test1>::names.size() == 4);
+	STATIC_REQUIRE(has_unscoped_api<traits_test1>);
+	STATIC_REQUIRE(conjure_enum<component>::count() == 10); // sparse enums in the same translation unit are still probed
+	REQUIRE(conjure_enum<component>::remove_scope("component::path") == "path");
+}
+
+//-----------------------------------------------------------------------------------------
+template<>
+struct FIX8::enum_cache<cache_test> // as written by conjure_enum_gen, without the optional sorted member
+{
+	static constexpr std::array values { cache_test::beta, cache_test::alpha };
+	static constexpr std::array<std::string_view, 2> names { "cache_test::beta", "cache_test::alpha" };
+};
+
+TEST_CASE("enum_cache")
+{
+	using ec = conjure_enum<cache_test>;
+	REQUIRE(ec::count() == 2); // both values are outside the default range so were not probed
+	REQUIRE(ec::enum_to_string(cache_test::alpha) == "cache_test::alpha");
+	REQUIRE(ec::enum_to_string<cache_test::beta>() == "cache_test::beta");
+	REQUIRE(ec::string_to_enum("cache_test::alpha") == cache_test::alpha);
+	REQUIRE(std::get<cache_test>(ec::sorted_entries[0]) == cache_test::alpha);
+	REQUIRE(ec::unscoped_string_to_enum("beta") == cache_test::beta);
+}
+
 //-----------------------------------------------------------------------------------------
 TEST_CASE("is_valid")
 {
@@ -141,6 +363,15 @@ TEST_CASE("is_valid")
 	REQUIRE(!conjure_enum<component1>::is_valid<static_cast<component1>(100)>());
 }
 
+//-----------------------------------------------------------------------------------------
+TEST_CASE("epeek_batch")
+{
+	const std::string_view batch { conjure_enum<component>::epeek_batch<component::scheme, static_cast<component>(100), component::path>() };
+	REQUIRE(batch.find("component::scheme") != std::string_view::npos);
+	REQUIRE(batch.find("component::path") != std::string_view::npos);
+	REQUIRE(batch.find("component::scheme") < batch.find("component::path"));
+}
+
 //-----------------------------------------------------------------------------------------
 TEST_CASE("is_scoped")
 {
@@ -291,6 +522,14 @@ TEST_CASE("enum_to_string")
 	REQUIRE(conjure_enum<component1>::enum_to_string<component1::fragment>() == "fragment");
 	using enum numbers;
 	REQUIRE(conjure_enum<numbers>::enum_to_string<two>() == "numbers::two");
+	REQUIRE(conjure_enum<offset_range_test>::is_continuous());
+	REQUIRE(conjure_enum<offset_range_test>::enum_to_string(offset_range_test::second) == "offset_range_test::second");
+	REQUIRE(conjure_enum<component>::enum_to_string(component::path, true) == "path");
+	REQUIRE(conjure_enum<component1>::enum_to_string(path, true) == "path");
+	REQUIRE(conjure_enum<component>::enum_to_string(static_cast<component>(100), true).empty());
+	STATIC_REQUIRE(conjure_enum<component>::enum_to_string(component::query, true) == "query");
+	for (const auto& [value, name] : conjure_enum<numbers64>::entries)
+		REQUIRE(conjure_enum<numbers64>::enum_to_string(value, true) == conjure_enum<numbers64>::remove_scope(name));
 }
 
 //-----------------------------------------------------------------------------------------
@@ -348,6 +587,21 @@ TEST_CASE("string_to_enum")
 	REQUIRE(static_cast<int>(conjure_enum<component>::string_to_enum("component::path").value()) == 12);
 	REQUIRE(static_cast<int>(conjure_enum<component1>::string_to_enum("path").value()) == 12);
 	REQUIRE(static_cast<int>(conjure_enum<component>::string_to_enum("wrong").value_or(component(100))) == 100);
+	REQUIRE(!conjure_enum<component>::string_to_enum("component::patx")); // same length as a name
+	REQUIRE(!conjure_enum<component>::string_to_enum(""));
+	STATIC_REQUIRE(conjure_enum<component>::string_to_enum("component::host") == component::host);
+	for (const auto& [value, name] : conjure_enum<numbers64>::entries)
+		REQUIRE(conjure_enum<numbers64>::string_to_enum(name) == value);
+	for (const auto& [value, name] : conjure_enum<component>::entries) // a difference at any position is a miss
+	{
+		REQUIRE(conjure_enum<component>::string_to_enum(name) == value);
+		for (std::size_t pos{}; pos < name.size(); ++pos)
+		{
+			std::string str{name};
+			str[pos] = '~';
+			REQUIRE(!conjure_enum<component>::string_to_enum(str));
+		}
+	}
 }
 
 //-----------------------------------------------------------------------------------------
@@ -356,6 +610,121 @@ TEST_CASE("unscoped_string_to_enum")
 	REQUIRE(static_cast<int>(conjure_enum<component>::unscoped_string_to_enum("userinfo").value()) == 2);
 	REQUIRE(static_cast<int>(conjure_enum<component1>::unscoped_string_to_enum("userinfo").value()) == 2);
 	REQUIRE(static_cast<int>(conjure_enum<component>::unscoped_string_to_enum("wrong").value_or(component(100))) == 100);
+	REQUIRE(conjure_enum<numbers64>::unscoped_string_to_enum("six") == numbers64::six);
+	REQUIRE(!conjure_enum<numbers64>::unscoped_string_to_enum("sex"));
+	for (const auto& [value, name] : conjure_enum<component>::unscoped_entries)
+	{
+		REQUIRE(conjure_enum<component>::unscoped_string_to_enum(name) == value);
+		for (std::size_t pos{}; pos < name.size(); ++pos)
+		{
+			std::string str{name};
+			str[pos] = '~';
+			REQUIRE(!conjure_enum<component>::unscoped_string_to_enum(str));
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("string_to_enum(const char *)")
+{
+	using ec = conjure_enum<component>;
+	const char *path { "component::path" }, *bad { "component::pat" }, *longer { "component::paths" }, *empty { "" }, *null{};
+	REQUIRE(ec::string_to_enum(path) == component::path);
+	REQUIRE(!ec::string_to_enum(bad));
+	REQUIRE(!ec::string_to_enum(longer));
+	REQUIRE(!ec::string_to_enum(empty));
+	REQUIRE(!ec::string_to_enum(null));
+	char buffer[] { "component::fragment" }; // as from argv
+	char *mutable_str { buffer };
+	REQUIRE(ec::string_to_enum(mutable_str) == component::fragment);
+	mutable_str[11] = 'F';
+	REQUIRE(!ec::string_to_enum(mutable_str));
+	const char *unscoped { "userinfo" };
+	REQUIRE(ec::unscoped_string_to_enum(unscoped) == component::userinfo);
+	REQUIRE(!ec::unscoped_string_to_enum(path));
+	REQUIRE(conjure_enum<component1>::string_to_enum(static_cast<const char *>("query")) == query);
+	// msg_test has an unscoped name longer than 12 characters, so its unscoped names are measured and hashed, not walked
+	REQUIRE(conjure_enum<msg_test>::unscoped_string_to_enum(static_cast<const char *>("mass_quote_acknowledgement_with_legs")) == msg_test::mass_quote_acknowledgement_with_legs);
+	REQUIRE(conjure_enum<msg_test>::unscoped_string_to_enum(static_cast<const char *>("logon")) == msg_test::logon);
+	REQUIRE(!conjure_enum<msg_test>::unscoped_string_to_enum(static_cast<const char *>("mass_quote_acknowledgement_with_leg")));
+	REQUIRE(!conjure_enum<msg_test>::unscoped_string_to_enum(static_cast<const char *>("logon ")));
+	const char *composite { "flags_test::read|flags_test::exec" };
+	REQUIRE(conjure_enum<flags_test>::string_to_enum(composite) == static_cast<flags_test>(5));
+	for (const auto& [value, name] : conjure_enum<numbers64>::entries)
+	{
+		const std::string str { name };
+		REQUIRE(conjure_enum<numbers64>::string_to_enum(str.c_str()) == value);
+		REQUIRE(conjure_enum<numbers64>::unscoped_string_to_enum(str.c_str() + str.find(':') + 2) == value);
+	}
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("any_string_to_enum")
+{
+	using ec = conjure_enum<component>;
+	REQUIRE(ec::any_string_to_enum("component::path") == component::path);
+	REQUIRE(ec::any_string_to_enum("path") == component::path);
+	REQUIRE(!ec::any_string_to_enum("component::bad"));
+	REQUIRE(!ec::any_string_to_enum("patx"));
+	REQUIRE(!ec::any_string_to_enum("::path"));
+	REQUIRE(!ec::any_string_to_enum(""));
+	STATIC_REQUIRE(ec::any_string_to_enum("userinfo") == component::userinfo);
+	REQUIRE(conjure_enum<component1>::any_string_to_enum("query") == query);
+	REQUIRE(!conjure_enum<component1>::any_string_to_enum("component1::query"));
+	for (const auto& [value, name] : conjure_enum<numbers64>::entries)
+	{
+		REQUIRE(conjure_enum<numbers64>::any_string_to_enum(name) == value);
+		REQUIRE(conjure_enum<numbers64>::any_string_to_enum(conjure_enum<numbers64>::remove_scope(name)) == value);
+	}
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("nocase_string_to_enum")
+{
+	using ec = conjure_enum<component>;
+	REQUIRE(ec::nocase_string_to_enum("component::path") == component::path);
+	REQUIRE(ec::nocase_string_to_enum("COMPONENT::PATH") == component::path);
+	REQUIRE(ec::nocase_string_to_enum("Component::UserInfo") == component::userinfo);
+	REQUIRE(!ec::nocase_string_to_enum("COMPONENT::PATX"));
+	REQUIRE(!ec::nocase_string_to_enum("PATH"));
+	REQUIRE(!ec::nocase_string_to_enum(""));
+	STATIC_REQUIRE(ec::nocase_string_to_enum("component::HOST") == component::host);
+	REQUIRE(ec::unscoped_nocase_string_to_enum("Path") == component::path);
+	REQUIRE(ec::unscoped_nocase_string_to_enum("FRAGMENT") == component::fragment);
+	REQUIRE(!ec::unscoped_nocase_string_to_enum("component::path"));
+	REQUIRE(!ec::unscoped_nocase_string_to_enum("FRAGMEN"));
+	REQUIRE(conjure_enum<component1>::nocase_string_to_enum("QUERY") == query);
+	for (const auto& [value, name] : conjure_enum<numbers64>::entries)
+	{
+		std::string str { name };
+		for (auto& chr : str)
+			if (chr >= 'a' && chr <= 'z')
+				chr -= 'a' - 'A';
+		REQUIRE(conjure_enum<numbers64>::nocase_string_to_enum(str) == value);
+		REQUIRE(conjure_enum<numbers64>::unscoped_nocase_string_to_enum(std::string_view(str).substr(str.rfind(':') + 1)) == value);
+		str.back() = '~';
+		REQUIRE(!conjure_enum<numbers64>::nocase_string_to_enum(str));
+	}
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("match_prefix")
+{
+	using ec = conjure_enum<component>;
+	REQUIRE(ec::match_prefix("component::path=/usr") == std::tuple { component::path, 15 });
+	REQUIRE(ec::unscoped_match_prefix("userinfo=x") == std::tuple { component::userinfo, 8 }); // longest of user and userinfo
+	REQUIRE(ec::unscoped_match_prefix("user=x") == std::tuple { component::user, 4 });
+	REQUIRE(ec::unscoped_match_prefix("users") == std::tuple { component::user, 4 });
+	REQUIRE(ec::unscoped_match_prefix("querying") == std::tuple { component::query, 5 });
+	REQUIRE(ec::unscoped_match_prefix("port") == std::tuple { component::port, 4 }); // exact
+	REQUIRE(!ec::unscoped_match_prefix("use"));
+	REQUIRE(!ec::unscoped_match_prefix(""));
+	REQUIRE(!ec::unscoped_match_prefix("component::port"));
+	REQUIRE(!ec::match_prefix("port"));
+	REQUIRE(conjure_enum<component1>::match_prefix("host:80") == std::tuple { host, 4 });
+	STATIC_REQUIRE(ec::unscoped_match_prefix("fragment#top") == std::tuple { component::fragment, 8 });
+	for (const auto& [value, name] : conjure_enum<numbers64>::entries)
+		REQUIRE(conjure_enum<numbers64>::match_prefix(std::string(name) + "=1") == std::tuple { value, name.size() });
 }
 
 //-----------------------------------------------------------------------------------------
@@ -433,6 +802,21 @@ TEST_CASE("conjure_type")
 	REQUIRE(conjure_type<component>::as_string_view() == "component"sv);
 }
 
+//-----------------------------------------------------------------------------------------
+TEST_CASE("conjure_short_type")
+{
+	REQUIRE(std::string_view(conjure_short_type<component>::name) == "component");
+	REQUIRE(conjure_short_type<numbers>::as_string_view() == "numbers"sv);
+	REQUIRE(conjure_short_type<static_only>::as_string_view() == "static_only"sv);
+	REQUIRE(conjure_short_type<fixed_string<8>>::as_string_view() == "fixed_string<...>"sv);
+	REQUIRE(conjure_short_type<conjure_enum<component>>::as_string_view() == "conjure_enum<...>"sv);
+	REQUIRE(conjure_short_type<conjure_enum<component>*>::as_string_view() == "conjure_enum<...>*"sv);
+	REQUIRE(conjure_short_type<int>::as_string_view() == "int"sv);
+	REQUIRE(conjure_short_type<component>::hash != 0);
+	REQUIRE(conjure_short_type<component>::hash != conjure_short_type<component1>::hash);
+	REQUIRE(conjure_short_type<fixed_string<8>>::hash != conjure_short_type<fixed_string<9>>::hash);
+}
+
 //-----------------------------------------------------------------------------------------
 TEST_CASE("for_each")
 {
@@ -495,6 +879,11 @@ TEST_CASE("dispatch")
 		})
 	};
 	REQUIRE(conjure_enum<component>::dispatch(component::port, -1, dd1, 10) == 2006);
+	for (const auto ev : conjure_enum<component>::values) // hits at either end and between, misses between
+		REQUIRE(conjure_enum<component>::dispatch(ev, -1, dd1, 10) == (ev == component::scheme ? 1000
+			: ev == component::port ? 2006 : ev == component::fragment ? 3014 : -1));
+	REQUIRE(conjure_enum<component>::dispatch(static_cast<component>(-5), -1, dd1, 10) == -1);
+	REQUIRE(conjure_enum<component>::dispatch(static_cast<component>(20), -1, dd1, 10) == -1);
 
 	struct foo
 	{
@@ -775,6 +1164,28 @@ TEST_CASE("enum_bitset(std::string_view)")
 {
 	REQUIRE_THROWS_MATCHES(enum_bitset<numbers>("zero,twenty,two,three", true, ',', false),
 		std::invalid_argument, Catch::Matchers::Message("twenty"));
+	REQUIRE(enum_bitset<numbers>("numbers::zero|two| numbers::three ", true) == enum_bitset<numbers>(0b1101));
+	REQUIRE(enum_bitset<numbers>("numbers::zero|two", false) == enum_bitset<numbers>(0b1));
+	REQUIRE(enum_bitset<numbers>("numbers::one||numbers::two|"sv) == enum_bitset<numbers>(0b110));
+	REQUIRE_THROWS_MATCHES(enum_bitset<numbers>("numbers::one||numbers::two"sv, false, '|', false),
+		std::invalid_argument, Catch::Matchers::Message(""));
+}
+
+//-----------------------------------------------------------------------------------------
+TEST_CASE("enum_bitset(const char *)")
+{
+	const char *names { " numbers::one | numbers::four|numbers::nine" }, *empty { "" }, *null{};
+	REQUIRE(enum_bitset<numbers>(names) == enum_bitset<numbers>(0b1000010010));
+	REQUIRE(enum_bitset<numbers>(names) == enum_bitset<numbers>(std::string_view(names)));
+	REQUIRE(enum_bitset<numbers>("numbers::one||numbers::two|") == enum_bitset<numbers>(0b110));
+	REQUIRE(enum_bitset<numbers>("two;three;nine", true, ';') == enum_bitset<numbers>(0b1000001100));
+	REQUIRE(!enum_bitset<numbers>(empty));
+	REQUIRE(!enum_bitset<numbers>(null));
+	REQUIRE(!enum_bitset<numbers>(0)); // literal 0 is the underlying value, not a null pointer
+	REQUIRE_THROWS_MATCHES(enum_bitset<numbers>("numbers::one||numbers::two", false, '|', false),
+		std::invalid_argument, Catch::Matchers::Message(""));
+	REQUIRE_THROWS_MATCHES(enum_bitset<numbers>("numbers::one|ten", false, '|', false),
+		std::invalid_argument, Catch::Matchers::Message("ten"));
 }
 
 //-----------------------------------------------------------------------------------------